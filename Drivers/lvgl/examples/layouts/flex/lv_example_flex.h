@@ -31,6 +31,7 @@ void lv_example_flex_3(void);
 void lv_example_flex_4(void);
 void lv_example_flex_5(void);
 void lv_example_flex_6(void);
+void lv_example_flex_7(void);
 
 /**********************
  *      MACROS
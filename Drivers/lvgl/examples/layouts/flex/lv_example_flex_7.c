@@ -0,0 +1,52 @@
+#include "../../lv_examples.h"
+#if LV_USE_FLEX && LV_USE_LABEL && LV_BUILD_EXAMPLES
+
+#define ITEM_CNT        200
+#define MEASURE_TIME    500     /*[ms] for every case*/
+
+static void measure(lv_obj_t * list, bool resize)
+{
+    uint32_t frame_cnt = 0;
+    uint32_t t = lv_tick_get();
+    while(lv_tick_elaps(t) < MEASURE_TIME) {
+        /*Change one label in every frame. When resizing, every second text has 2 lines*/
+        lv_obj_t * label = lv_obj_get_child(list, frame_cnt % ITEM_CNT);
+        if(resize && (frame_cnt & 1)) lv_label_set_text_fmt(label, "Item %" LV_PRIu32 "\nchanged", frame_cnt);
+        else lv_label_set_text_fmt(label, "Item %" LV_PRIu32, frame_cnt);
+
+        lv_obj_update_layout(list);
+        frame_cnt++;
+    }
+
+    uint32_t ns_per_frame = (uint32_t)((uint64_t)MEASURE_TIME * 1000000 / frame_cnt);
+    LV_LOG_USER("%s: %" LV_PRIu32 ".%03" LV_PRIu32 " us layout per frame, %" LV_PRIu32 " frames",
+                resize ? "size changes" : "same size", ns_per_frame / 1000, ns_per_frame % 1000, frame_cnt);
+    LV_UNUSED(ns_per_frame);
+}
+
+/**
+ * Measure the time of updating the layout of a list of 200 items
+ * when one of its labels changes in every frame.
+ * If the size of the label doesn't change only the label is laid out again.
+ * Compare the logged times with `LV_LAYOUT_DIRTY_SUBTREE 0`.
+ * The list needs about 100 kB of `LV_MEM_SIZE`.
+ */
+void lv_example_flex_7(void)
+{
+    lv_obj_t * list = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(list, lv_pct(100), lv_pct(100));
+    lv_obj_set_flex_flow(list, LV_FLEX_FLOW_COLUMN);
+
+    uint32_t i;
+    for(i = 0; i < ITEM_CNT; i++) {
+        lv_obj_t * label = lv_label_create(list);
+        lv_obj_set_width(label, lv_pct(100));
+        lv_label_set_text_fmt(label, "Item %" LV_PRIu32, i);
+    }
+    lv_obj_update_layout(list);
+
+    measure(list, false);
+    measure(list, true);
+}
+
+#endif
@@ -21,7 +21,9 @@ extern "C" {
 #include "imgfont/lv_example_imgfont.h"
 #include "monkey/lv_example_monkey.h"
 #include "observer/lv_example_observer.h"
+#include "refr/lv_example_refr.h"
 #include "snapshot/lv_example_snapshot.h"
+#include "timer/lv_example_timer.h"
 #include "gestures/lv_example_gestures.h"
 #include "xml/lv_example_xml.h"
 #include "translation/lv_example_translation.h"
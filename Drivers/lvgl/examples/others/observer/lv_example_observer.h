@@ -32,6 +32,7 @@ void lv_example_observer_4(void);
 void lv_example_observer_5(void);
 void lv_example_observer_6(void);
 void lv_example_observer_7(void);
+void lv_example_observer_8(void);
 
 /**********************
  *      MACROS
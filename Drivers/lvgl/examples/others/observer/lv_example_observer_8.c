@@ -0,0 +1,102 @@
+#include "../../lv_examples.h"
+#if LV_USE_OBSERVER && LV_USE_ARC && LV_USE_SLIDER && LV_USE_LABEL && LV_BUILD_EXAMPLES
+
+#define SAMPLE_RATE_HZ  1000
+#define MEASURE_TIME    2000
+
+static lv_subject_t sensor_subject;
+static uint32_t sample_cnt;
+static uint32_t format_cnt;
+static uint32_t invalidate_cnt;
+static uint32_t frame_cnt;
+static uint32_t measure_start;
+
+static void sensor_timer_cb(lv_timer_t * timer)
+{
+    /*Emulate a sensor task sampling at SAMPLE_RATE_HZ regardless of the timer's resolution*/
+    uint32_t * last_sample_time = lv_timer_get_user_data(timer);
+    uint32_t elaps = lv_tick_elaps(*last_sample_time);
+    uint32_t sample_to_do = elaps * SAMPLE_RATE_HZ / 1000;
+    *last_sample_time += sample_to_do * 1000 / SAMPLE_RATE_HZ;
+
+    while(sample_to_do) {
+        /*A slowly changing value, so many samples are the same as the previous one*/
+        int32_t v = (int32_t)((sample_cnt / 8) % 200);
+        if(v > 100) v = 200 - v;
+        lv_subject_set_int(&sensor_subject, v);
+        sample_cnt++;
+        sample_to_do--;
+    }
+}
+
+static void format_counter_cb(lv_observer_t * observer, lv_subject_t * subject)
+{
+    LV_UNUSED(observer);
+    LV_UNUSED(subject);
+    format_cnt++;
+}
+
+static void display_event_cb(lv_event_t * e)
+{
+    lv_event_code_t code = lv_event_get_code(e);
+    if(code == LV_EVENT_INVALIDATE_AREA) {
+        invalidate_cnt++;
+        return;
+    }
+
+    frame_cnt++;
+    if(lv_tick_elaps(measure_start) < MEASURE_TIME) return;
+
+    bool batched = lv_subject_get_batched(&sensor_subject);
+    LV_LOG_USER("%s: %" LV_PRIu32 " samples, %" LV_PRIu32 " frames, %" LV_PRIu32 ".%02" LV_PRIu32
+                " formats/frame, %" LV_PRIu32 ".%02" LV_PRIu32 " invalidations/frame",
+                batched ? "batched" : "immediate", sample_cnt, frame_cnt,
+                format_cnt / frame_cnt, (format_cnt * 100 / frame_cnt) % 100,
+                invalidate_cnt / frame_cnt, (invalidate_cnt * 100 / frame_cnt) % 100);
+
+    /*Measure the other mode too*/
+    lv_subject_set_batched(&sensor_subject, !batched);
+    sample_cnt = 0;
+    format_cnt = 0;
+    invalidate_cnt = 0;
+    frame_cnt = 0;
+    measure_start = lv_tick_get();
+}
+
+/**
+ * Bind a label, an arc and a slider to a subject updated 1000 times per second
+ * and count the label formats and invalidations per frame.
+ * In batched mode the widgets are updated only once per refresh with the latest value.
+ */
+void lv_example_observer_8(void)
+{
+    lv_subject_init_int(&sensor_subject, 0);
+
+    lv_obj_t * arc = lv_arc_create(lv_screen_active());
+    lv_obj_set_size(arc, 150, 150);
+    lv_obj_align(arc, LV_ALIGN_TOP_MID, 0, 10);
+    lv_arc_bind_value(arc, &sensor_subject);
+
+    lv_obj_t * label = lv_label_create(arc);
+    lv_obj_center(label);
+    lv_label_bind_text(label, &sensor_subject, "%" LV_PRId32 " %%");
+
+    lv_obj_t * slider = lv_slider_create(lv_screen_active());
+    lv_obj_set_width(slider, lv_pct(80));
+    lv_obj_align(slider, LV_ALIGN_BOTTOM_MID, 0, -30);
+    lv_slider_bind_value(slider, &sensor_subject);
+
+    /*Notified as many times as the label is formatted*/
+    lv_subject_add_observer(&sensor_subject, format_counter_cb, NULL);
+
+    lv_display_t * disp = lv_display_get_default();
+    lv_display_add_event_cb(disp, display_event_cb, LV_EVENT_INVALIDATE_AREA, NULL);
+    lv_display_add_event_cb(disp, display_event_cb, LV_EVENT_REFR_READY, NULL);
+
+    static uint32_t last_sample_time;
+    last_sample_time = lv_tick_get();
+    measure_start = last_sample_time;
+    lv_timer_create(sensor_timer_cb, 1, &last_sample_time);
+}
+
+#endif
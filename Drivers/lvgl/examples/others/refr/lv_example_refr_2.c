@@ -0,0 +1,80 @@
+#include "../../lv_examples.h"
+#if LV_USE_LABEL && LV_USE_OBJ_RENDER_CACHE && LV_BUILD_EXAMPLES
+
+#define TICK_CNT    24
+
+static lv_obj_t * value_label;
+static uint32_t frame_cnt;
+static uint32_t render_start;
+static uint32_t render_time_sum;
+
+static void update_timer_cb(lv_timer_t * timer)
+{
+    LV_UNUSED(timer);
+
+    lv_label_set_text_fmt(value_label, "%" LV_PRIu32, lv_rand(0, 999));
+}
+
+static void render_start_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+
+    render_start = lv_tick_get();
+}
+
+static void refr_ready_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+
+    frame_cnt++;
+    render_time_sum += lv_tick_elaps(render_start);
+    if(frame_cnt == 100) {
+        lv_obj_render_cache_stats_t stats;
+        lv_obj_render_cache_get_stats(&stats);
+        LV_LOG_USER("Average of 100 frames: %" LV_PRIu32 " ms render time, cache hit: %" LV_PRIu32
+                    ", miss: %" LV_PRIu32 ", size: %" LV_PRIu32 " bytes",
+                    render_time_sum / frame_cnt, stats.hit_cnt, stats.miss_cnt, stats.size);
+        lv_obj_render_cache_reset_stats();
+        frame_cnt = 0;
+        render_time_sum = 0;
+    }
+}
+
+/**
+ * A gauge-like panel with many static labels under a frequently updated label.
+ * The panel is opaque so it's cached in the display's color format (16 kB with RGB565).
+ * It is rendered only once and its cached image is drawn when the label changes.
+ * Compare the logged render time with `lv_obj_set_render_cache(panel, false)`.
+ */
+void lv_example_refr_2(void)
+{
+    lv_obj_t * panel = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(panel, 90, 90);
+    lv_obj_center(panel);
+    lv_obj_set_style_radius(panel, 0, 0);
+    lv_obj_set_style_bg_grad_color(panel, lv_palette_lighten(LV_PALETTE_GREY, 2), 0);
+    lv_obj_set_style_bg_grad_dir(panel, LV_GRAD_DIR_VER, 0);
+    lv_obj_remove_flag(panel, LV_OBJ_FLAG_SCROLLABLE);
+
+    uint32_t i;
+    for(i = 0; i < TICK_CNT; i++) {
+        lv_obj_t * tick = lv_label_create(panel);
+        int32_t angle = (int32_t)(i * 3600 / TICK_CNT);
+        lv_label_set_text_fmt(tick, "%" LV_PRIu32, i);
+        lv_obj_align(tick, LV_ALIGN_CENTER, lv_trigo_cos(angle / 10) * 32 / LV_TRIGO_SIN_MAX,
+                     lv_trigo_sin(angle / 10) * 32 / LV_TRIGO_SIN_MAX);
+    }
+
+    lv_obj_set_render_cache(panel, true);
+
+    /*Not a child of the panel so updating it doesn't invalidate the cached image*/
+    value_label = lv_label_create(lv_screen_active());
+    lv_obj_center(value_label);
+
+    lv_display_t * disp = lv_display_get_default();
+    lv_display_add_event_cb(disp, render_start_cb, LV_EVENT_RENDER_START, NULL);
+    lv_display_add_event_cb(disp, refr_ready_cb, LV_EVENT_REFR_READY, NULL);
+    lv_timer_create(update_timer_cb, 10, NULL);
+}
+
+#endif
@@ -0,0 +1,67 @@
+#include "../../lv_examples.h"
+#if LV_BUILD_EXAMPLES
+
+#define MEASURE_TIME    500     /*[ms] for every timer count*/
+#define TIMER_CNT_MAX   1000
+
+static lv_timer_t * timers[TIMER_CNT_MAX];
+static uint32_t cb_cnt;
+
+static void one_shot_cb(lv_timer_t * timer)
+{
+    LV_UNUSED(timer);
+    cb_cnt++;
+}
+
+static void periodic_cb(lv_timer_t * timer)
+{
+    cb_cnt++;
+
+    /*Some timers start a one shot timer, which deletes itself after running, like many widgets do*/
+    if((lv_uintptr_t)lv_timer_get_user_data(timer) % 8 == 0) {
+        lv_timer_t * one_shot = lv_timer_create(one_shot_cb, 0, NULL);
+        if(one_shot) lv_timer_set_repeat_count(one_shot, 1);
+    }
+}
+
+static void measure(uint32_t timer_cnt)
+{
+    /*Periods between 20 and 1019 ms, so only a few timers are due at a time*/
+    uint32_t i;
+    for(i = 0; i < timer_cnt; i++) {
+        timers[i] = lv_timer_create(periodic_cb, 20 + (i * 37) % 1000, (void *)(lv_uintptr_t)i);
+    }
+
+    cb_cnt = 0;
+    uint32_t call_cnt = 0;
+    uint32_t t = lv_tick_get();
+    while(lv_tick_elaps(t) < MEASURE_TIME) {
+        lv_timer_handler();
+        call_cnt++;
+    }
+
+    uint32_t ns_per_call = (uint32_t)((uint64_t)MEASURE_TIME * 1000000 / call_cnt);
+    LV_LOG_USER("%4" LV_PRIu32 " timers: %" LV_PRIu32 ".%03" LV_PRIu32 " us per lv_timer_handler() call, %"
+                LV_PRIu32 " calls, %" LV_PRIu32 " callbacks",
+                timer_cnt, ns_per_call / 1000, ns_per_call % 1000, call_cnt, cb_cnt);
+    LV_UNUSED(ns_per_call);
+
+    for(i = 0; i < timer_cnt; i++) {
+        lv_timer_delete(timers[i]);
+    }
+}
+
+/**
+ * Call `lv_timer_handler()` as often as possible with 10, 100 and 1000 timers
+ * of different periods and log the time of a call.
+ * Compare the results with `LV_USE_TIMER_HEAP` enabled and disabled.
+ * 1000 timers need about 60 kB, so increase `LV_MEM_SIZE` if required.
+ */
+void lv_example_timer_1(void)
+{
+    measure(10);
+    measure(100);
+    measure(1000);
+}
+
+#endif
@@ -39,10 +39,22 @@
 static void disp_init(void);
 
 static void disp_flush(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
+static void scroll_obj_delete_event_cb(lv_event_t * e);
+static void resolution_changed_event_cb(lv_event_t * e);
+static void invalidate_scrollbars(lv_obj_t * obj, int32_t dy);
+static void screen_format_event_cb(lv_event_t * e);
+static uint8_t get_screen_format(lv_obj_t * screen);
+static lv_display_t * panel_display_create(LCD_HandleTypeDef * hlcd);
+static LCD_HandleTypeDef * select_panel(lv_display_t * disp);
+static void flush_done_cb(LCD_HandleTypeDef * hlcd);
 
 /**********************
  *  STATIC VARIABLES
  **********************/
+static lv_obj_t * scroll_obj;       /*The object scrolled by moving the start line of the panel*/
+static lv_area_t scroll_area;       /*The rows of `scroll_obj` when the scroll area of the panel was set*/
+static lv_port_disp_te_mode_t te_mode;
+static bool frame_started;          /*An area of the current frame of the TE synchronized panel was already flushed*/
 
 /**********************
  *      MACROS
@@ -62,8 +74,7 @@ void lv_port_disp_init(void)
     /*------------------------------------
      * Create a display and set a flush_cb
      * -----------------------------------*/
-    lv_display_t * disp = lv_display_create(MY_DISP_HOR_RES, MY_DISP_VER_RES);
-    lv_display_set_flush_cb(disp, disp_flush);
+    lv_display_t * disp = panel_display_create(&hlcd1);
 
     /* Example 1
      * One buffer for partial rendering*/
@@ -91,12 +102,257 @@ void lv_port_disp_init(void)
     // static uint8_t buf_3_2[MY_DISP_HOR_RES * MY_DISP_VER_RES * BYTE_PER_PIXEL];
     // lv_display_set_buffers(disp, buf_3_1, buf_3_2, sizeof(buf_3_1), LV_DISPLAY_RENDER_MODE_DIRECT);
 
+    // /* Example 4
+    //  * A second panel on its own SPI bus with a TX DMA configured in CubeMX (e.g. SPI1).
+    //  * While one panel is being sent by its DMA, LVGL renders and sends the other one.*/
+    // static LCD_HandleTypeDef hlcd2 = {
+    //     .hspi = &hspi1,
+    //     .DC_Port = GPIOB, .DC_Pin = GPIO_PIN_0,
+    //     .Backlight_Port = GPIOB, .Backlight_Pin = GPIO_PIN_1,
+    //     .Panel_Width = 240, .Panel_Height = 240,
+    // };
+    // LV_ATTRIBUTE_MEM_ALIGN
+    // static uint8_t buf_4_1[240 * 10 * BYTE_PER_PIXEL];
+    //
+    // LV_ATTRIBUTE_MEM_ALIGN
+    // static uint8_t buf_4_2[240 * 10 * BYTE_PER_PIXEL];
+    // lv_port_disp_add_panel(&hlcd2, buf_4_1, buf_4_2, sizeof(buf_4_1));
+}
+
+lv_display_t * lv_port_disp_add_panel(LCD_HandleTypeDef * hlcd, void * buf_1, void * buf_2, uint32_t buf_size)
+{
+    if(LCD_Init(hlcd) != HAL_OK) {
+        LV_LOG_ERROR("at most %d panels can be used, see LCD_MAX_PANELS", LCD_MAX_PANELS);
+        LCD_Select(&hlcd1);
+        return NULL;
+    }
+
+    lv_display_t * disp = panel_display_create(hlcd);
+    lv_display_set_buffers(disp, buf_1, buf_2, buf_size, LV_DISPLAY_RENDER_MODE_PARTIAL);
+
+    /*The drawing functions of the driver keep working on the first panel*/
+    LCD_Select(&hlcd1);
+
+    return disp;
+}
+
+void lv_port_disp_set_scroll_obj(lv_obj_t * obj)
+{
+    if(scroll_obj) {
+        lv_display_t * disp = lv_obj_get_display(scroll_obj);
+        lv_obj_remove_event_cb(scroll_obj, scroll_obj_delete_event_cb);
+        scroll_obj = NULL;
+
+        /*The rows are in a different order on the panel, redraw them*/
+        select_panel(disp);
+        LCD_ScrollOff();
+        lv_obj_invalidate_area(lv_display_get_screen_active(disp), &scroll_area);
+    }
+
+    if(obj == NULL) return;
+
+    /*Only a full width area can be scrolled by the panel*/
+    lv_display_t * disp = lv_obj_get_display(obj);
+    lv_obj_update_layout(obj);
+    lv_area_t coords;
+    lv_obj_get_coords(obj, &coords);
+    int32_t ver_res = lv_display_get_vertical_resolution(disp);
+    if(coords.x1 > 0 || coords.x2 < lv_display_get_horizontal_resolution(disp) - 1) return;
+    if(coords.y1 < 0 || coords.y2 >= ver_res) return;
+
+    select_panel(disp);
+    if(LCD_SetScrollArea(coords.y1, ver_res - 1 - coords.y2) != HAL_OK) return;
+
+    scroll_obj = obj;
+    scroll_area = coords;
+    lv_obj_add_event_cb(obj, scroll_obj_delete_event_cb, LV_EVENT_DELETE, NULL);
+}
+
+void lv_port_disp_scroll_by(lv_obj_t * obj, int32_t dy)
+{
+    if(dy == 0) return;
+
+    /*Fall back to normal scrolling if the panel can't scroll this object*/
+    if(obj != scroll_obj) {
+        lv_obj_scroll_by(obj, 0, dy, LV_ANIM_OFF);
+        return;
+    }
+
+    /*Follow if the object was moved or resized*/
+    lv_obj_update_layout(obj);
+    lv_area_t coords;
+    lv_obj_get_coords(obj, &coords);
+    if(coords.y1 != scroll_area.y1 || coords.y2 != scroll_area.y2 ||
+       coords.x1 != scroll_area.x1 || coords.x2 != scroll_area.x2) {
+        lv_port_disp_set_scroll_obj(obj);
+        lv_obj_scroll_by(obj, 0, dy, LV_ANIM_OFF);
+        return;
+    }
+
+    int32_t h = lv_area_get_height(&scroll_area);
+    if(LV_ABS(dy) >= h) {
+        lv_obj_scroll_by(obj, 0, dy, LV_ANIM_OFF);
+        return;
+    }
+
+    /*Send the pending changes first as they are not at the scrolled position*/
+    lv_display_t * disp = lv_obj_get_display(obj);
+    lv_refr_now(disp);
+
+    lv_display_enable_invalidation(disp, false);
+    lv_obj_scroll_by(obj, 0, dy, LV_ANIM_OFF);
+    lv_display_enable_invalidation(disp, true);
+
+    /*The content moves down by `dy` so the first shown line moves up*/
+    select_panel(disp);
+    LCD_SetScrollStart((uint16_t)((LCD_GetScrollStart() + h - dy) % h));
+
+    /*Only the exposed rows need to be rendered and sent*/
+    lv_area_t band = scroll_area;
+    if(dy < 0) band.y1 = band.y2 + dy + 1;
+    else band.y2 = band.y1 + dy - 1;
+    lv_obj_invalidate_area(obj, &band);
+
+    invalidate_scrollbars(obj, dy);
+}
+
+void lv_port_disp_set_screen_format(lv_obj_t * screen, uint8_t format)
+{
+    /*The format is stored in the user data of an event callback to keep the screen's own user data free*/
+    lv_obj_remove_event_cb(screen, screen_format_event_cb);
+    if(format == LCD_Format_RGB565) return;
+
+    lv_obj_add_event_cb(screen, screen_format_event_cb, LV_EVENT_DELETE, (void *)(lv_uintptr_t)format);
+}
+
+void lv_port_disp_set_te_mode(lv_port_disp_te_mode_t mode)
+{
+    if(mode == te_mode) return;
+
+    LCD_Select(&hlcd1);
+
+    if(mode == LV_PORT_DISP_TE_OFF) LCD_TE_Off();
+    else if(te_mode == LV_PORT_DISP_TE_OFF) LCD_TE_On();
+
+    if(mode == LV_PORT_DISP_TE_VSYNC) LCD_TE_SetMode(LCD_TE_Mode_Vsync);
+    else if(mode == LV_PORT_DISP_TE_BEAM) LCD_TE_SetMode(LCD_TE_Mode_Beam);
+    else LCD_TE_SetMode(LCD_TE_Mode_Off);
+
+    te_mode = mode;
+    frame_started = false;
 }
 
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
+/*Create a display for a panel. The panel's handle is the driver data of the display.*/
+static lv_display_t * panel_display_create(LCD_HandleTypeDef * hlcd)
+{
+    lv_display_t * disp = lv_display_create(hlcd->Panel_Width, hlcd->Panel_Height);
+    lv_display_set_flush_cb(disp, disp_flush);
+    lv_display_set_driver_data(disp, hlcd);
+
+    /*Called when the panel's DMA has finished, or right away when sending without DMA*/
+    hlcd->TxCpltCallback = flush_done_cb;
+    hlcd->User_Data = disp;
+
+    /*Rotate with the panel's memory access control instead of rotating the rendered areas*/
+    lv_display_add_event_cb(disp, resolution_changed_event_cb, LV_EVENT_RESOLUTION_CHANGED, NULL);
+
+    return disp;
+}
+
+/*Make the driver's functions work on the panel of a display*/
+static LCD_HandleTypeDef * select_panel(lv_display_t * disp)
+{
+    LCD_HandleTypeDef * hlcd = lv_display_get_driver_data(disp);
+    LCD_Select(hlcd);
+    return hlcd;
+}
+
+static void flush_done_cb(LCD_HandleTypeDef * hlcd)
+{
+    lv_display_flush_ready(hlcd->User_Data);
+}
+
+/*Only carries the format of the screen, see `get_screen_format()`*/
+static void screen_format_event_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+}
+
+static uint8_t get_screen_format(lv_obj_t * screen)
+{
+    if(screen == NULL) return LCD_Format_RGB565;
+
+    uint32_t event_cnt = lv_obj_get_event_count(screen);
+    uint32_t i;
+    for(i = 0; i < event_cnt; i++) {
+        lv_event_dsc_t * dsc = lv_obj_get_event_dsc(screen, i);
+        if(lv_event_dsc_get_cb(dsc) == screen_format_event_cb) {
+            return (uint8_t)(lv_uintptr_t)lv_event_dsc_get_user_data(dsc);
+        }
+    }
+
+    return LCD_Format_RGB565;
+}
+
+/*Set the panel's direction to match the rotation of the display.
+ *The panel maps the rendered areas to its memory, so they can be sent as they are.
+ *LVGL has already swapped the resolution and invalidated the whole screen.*/
+static void resolution_changed_event_cb(lv_event_t * e)
+{
+    lv_display_t * disp = lv_event_get_target(e);
+    select_panel(disp);
+
+    switch(lv_display_get_rotation(disp)) {
+        case LV_DISPLAY_ROTATION_0:
+            LCD_SetDirection(Direction_V);
+            break;
+        case LV_DISPLAY_ROTATION_90:
+            LCD_SetDirection(Direction_H_Flip);
+            break;
+        case LV_DISPLAY_ROTATION_180:
+            LCD_SetDirection(Direction_V_Flip);
+            break;
+        case LV_DISPLAY_ROTATION_270:
+            LCD_SetDirection(Direction_H);
+            break;
+    }
+
+    /*Changing the direction has stopped the hardware scrolling, check if it's still possible*/
+    if(scroll_obj && lv_obj_get_display(scroll_obj) == disp) lv_port_disp_set_scroll_obj(scroll_obj);
+}
+
+static void scroll_obj_delete_event_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    lv_port_disp_set_scroll_obj(NULL);
+}
+
+/*The scrollbars were moved by the panel together with the content,
+ *so redraw them where they were shown and where they should be now*/
+static void invalidate_scrollbars(lv_obj_t * obj, int32_t dy)
+{
+    lv_area_t hor_area;
+    lv_area_t ver_area;
+    lv_obj_get_scrollbar_area(obj, &hor_area, &ver_area);
+
+    if(lv_area_get_size(&ver_area) > 0) {
+        ver_area.y1 = scroll_area.y1;
+        ver_area.y2 = scroll_area.y2;
+        lv_obj_invalidate_area(obj, &ver_area);
+    }
+
+    if(lv_area_get_size(&hor_area) > 0) {
+        lv_obj_invalidate_area(obj, &hor_area);
+        lv_area_move(&hor_area, 0, dy);
+        lv_obj_invalidate_area(obj, &hor_area);
+    }
+}
+
+
 /*Initialize your display and the required peripherals.*/
 static void disp_init(void)
 {
@@ -139,10 +395,34 @@ static void disp_flush(lv_display_t * disp_drv, const lv_area_t * area, uint8_t
     //         }
     //     }
     // }
-    LCD_CopyBuffer(area->x1, area->y1, area->x2 - area->x1 + 1, area->y2 - area->y1 + 1, (uint16_t *)px_map);
+    LCD_HandleTypeDef * hlcd = select_panel(disp_drv);
+
+    /*The areas of a frame belong to the active screen, even during a screen load animation*/
+    uint8_t format = get_screen_format(lv_display_get_screen_active(disp_drv));
+    if(format != LCD_GetPixelFormat()) LCD_SetPixelFormat(format);
+
+    if(hlcd == &hlcd1 && te_mode != LV_PORT_DISP_TE_OFF) {
+        if(!frame_started) {
+            LCD_TE_FrameStart();
+            frame_started = true;
+        }
+        if(lv_display_flush_is_last(disp_drv)) frame_started = false;
+    }
+
     /*IMPORTANT!!!
-     *Inform the graphics library that you are ready with the flushing*/
-    lv_display_flush_ready(disp_drv);
+     *`flush_done_cb()` informs the graphics library that you are ready with the flushing.
+     *With DMA it's called from the SPI interrupt and LVGL can render the next area or the other panels meanwhile.*/
+    int32_t w = lv_area_get_width(area);
+    int32_t h = lv_area_get_height(area);
+    if(LCD_CopyBuffer_DMA(area->x1, area->y1, w, h, (uint16_t *)px_map) != HAL_OK) {
+        /*The DMA couldn't be started, so `flush_done_cb()` won't be called. Send the area while waiting.*/
+        LV_LOG_WARN("DMA transfer failed, sending the area without DMA");
+        LCD_CopyBuffer(area->x1, area->y1, w, h, (uint16_t *)px_map);
+        lv_display_flush_ready(disp_drv);
+    }
+
+    /*The drawing functions of the driver keep working on the first panel*/
+    LCD_Select(&hlcd1);
 }
 
 #else /*Enable this file at the top*/
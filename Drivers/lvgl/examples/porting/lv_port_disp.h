@@ -21,6 +21,7 @@ extern "C" {
 #else
 #include "lvgl.h"
 #endif
+#include "hw/LCD/st7789.h"
 
 /*********************
  *      DEFINES
@@ -29,13 +30,29 @@ extern "C" {
 /**********************
  *      TYPEDEFS
  **********************/
+typedef enum {
+    LV_PORT_DISP_TE_OFF,    /*Send the areas as soon as they are rendered*/
+    LV_PORT_DISP_TE_VSYNC,  /*Start sending every frame at the panel's tearing effect (TE) signal*/
+    LV_PORT_DISP_TE_BEAM,   /*Start every frame when its rows won't cross the panel's scan line, even if sending is slower than the scanning*/
+} lv_port_disp_te_mode_t;
 
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
-/* Initialize low level display driver */
+/* Initialize low level display driver
+ * `lv_display_set_rotation()` is applied by the panel (`LCD_SetDirection()`), so rotated areas are sent as they are.
+ */
 void lv_port_disp_init(void);
 
+/* Add one more panel as a new display with its own buffers for partial rendering.
+ * The pins, SPI and size of the panel should be set in `hlcd`, and its SPI should differ from the other panels'
+ * and have a TX DMA to send the panels concurrently. Panels without DMA are sent while LVGL waits.
+ * Hardware scrolling works on any panel, the TE synchronization only on the first one (`hlcd1`).
+ * After flushing `hlcd1` is selected again, so call `LCD_Select()` before using the driver's drawing functions on the other panels.
+ * Returns NULL if `LCD_MAX_PANELS` panels are already used.
+ */
+lv_display_t * lv_port_disp_add_panel(LCD_HandleTypeDef * hlcd, void * buf_1, void * buf_2, uint32_t buf_size);
+
 /* Enable updating the screen (the flushing process) when disp_flush() is called by LVGL
  */
 void disp_enable_update(void);
@@ -44,6 +61,30 @@ void disp_enable_update(void);
  */
 void disp_disable_update(void);
 
+/* Scroll an object by moving the start line of the panel instead of redrawing it.
+ * The object should be as wide as the screen, have an opaque and plain background without border
+ * and radius, and not be covered by other objects. Pass NULL to stop using the panel's scrolling.
+ */
+void lv_port_disp_set_scroll_obj(lv_obj_t * obj);
+
+/* Scroll an object vertically by `dy` pixels.
+ * If it's the object set by `lv_port_disp_set_scroll_obj()` only the newly exposed rows are rendered and sent.
+ */
+void lv_port_disp_scroll_by(lv_obj_t * obj, int32_t dy);
+
+/* Send the areas of a screen in a different pixel format, e.g. `LCD_Format_RGB444` to send 25% less data.
+ * The rendered RGB565 pixels are converted while sending, so the format can differ screen by screen.
+ */
+void lv_port_disp_set_screen_format(lv_obj_t * screen, uint8_t format);
+
+/* Synchronize the flushing to the scanning of the panel to avoid tearing.
+ * The TE pin of the panel should be connected and its interrupt should call `LCD_TE_Callback()`.
+ * `LV_PORT_DISP_TE_VSYNC` suits full screen buffers, and when rotated by 90 or 270 degrees,
+ * `LV_PORT_DISP_TE_BEAM` suits partial buffers with any rotation except 90 and 270 degrees.
+ * The frame pacing statistics can be read with `LCD_TE_GetStats()`.
+ */
+void lv_port_disp_set_te_mode(lv_port_disp_te_mode_t mode);
+
 /**********************
  *      MACROS
  **********************/
@@ -44,6 +44,8 @@ void lv_example_style_16(void);
 void lv_example_style_17(void);
 void lv_example_style_18(void);
 void lv_example_style_19(void);
+void lv_example_style_20(void);
+void lv_example_style_22(void);
 
 /**********************
  *      MACROS
@@ -0,0 +1,55 @@
+#include "../lv_examples.h"
+#if LV_BUILD_EXAMPLES && LV_USE_LABEL && LV_USE_SWITCH && LV_USE_SLIDER
+
+#define ROW_CNT         25
+#define MEASURE_CNT     20
+
+/**
+ * Create a settings page of 100 widgets: 25 rows with a label, a switch and a slider,
+ * redraw it several times and log the time of a refresh.
+ * Drawing reads dozens of style properties of every part of every widget.
+ * Compare the results with different `LV_OBJ_STYLE_RESOLVED_CACHE_LINES` values.
+ */
+void lv_example_style_20(void)
+{
+    lv_obj_t * page = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(page, lv_pct(100), lv_pct(100));
+    lv_obj_set_flex_flow(page, LV_FLEX_FLOW_COLUMN);
+    lv_obj_set_style_pad_all(page, 4, 0);
+    lv_obj_set_style_pad_row(page, 2, 0);
+
+    uint32_t i;
+    for(i = 0; i < ROW_CNT; i++) {
+        lv_obj_t * row = lv_obj_create(page);
+        lv_obj_set_size(row, lv_pct(100), LV_SIZE_CONTENT);
+        lv_obj_set_style_pad_all(row, 2, 0);
+        lv_obj_set_flex_flow(row, LV_FLEX_FLOW_ROW);
+        lv_obj_set_flex_align(row, LV_FLEX_ALIGN_SPACE_BETWEEN, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
+
+        lv_obj_t * label = lv_label_create(row);
+        lv_label_set_text_fmt(label, "Option %" LV_PRIu32, i + 1);
+
+        lv_obj_t * sw = lv_switch_create(row);
+        lv_obj_set_size(sw, 36, 18);
+        if(i % 3 == 0) lv_obj_add_state(sw, LV_STATE_CHECKED);
+
+        lv_obj_t * slider = lv_slider_create(row);
+        lv_obj_set_width(slider, lv_pct(35));
+        lv_slider_set_value(slider, (int32_t)(i * 4), LV_ANIM_OFF);
+    }
+
+    lv_refr_now(NULL);
+
+    uint32_t t = lv_tick_get();
+    for(i = 0; i < MEASURE_CNT; i++) {
+        lv_obj_invalidate(lv_screen_active());
+        lv_refr_now(NULL);
+    }
+    uint32_t elaps = lv_tick_elaps(t);
+
+    LV_LOG_USER("%d widgets: %" LV_PRIu32 ".%" LV_PRIu32 " ms per refresh", ROW_CNT * 4,
+                elaps / MEASURE_CNT, (elaps * 10 / MEASURE_CNT) % 10);
+    LV_UNUSED(elaps);
+}
+
+#endif
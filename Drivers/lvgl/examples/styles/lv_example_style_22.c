@@ -0,0 +1,50 @@
+#include "../lv_examples.h"
+#if LV_BUILD_EXAMPLES && LV_USE_LABEL
+
+#define CARD_CNT        12
+#define MEASURE_CNT     20
+
+/**
+ * Create a grid of cards with rounded corners and shadows,
+ * redraw them several times and log the time of a refresh.
+ * The cards have only a few different shadows so their blurred corners can be reused.
+ * Compare the results with `LV_DRAW_SW_SHADOW_CACHE_SIZE 0`.
+ */
+void lv_example_style_22(void)
+{
+    lv_obj_t * cont = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(cont, lv_pct(100), lv_pct(100));
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_ROW_WRAP);
+    lv_obj_set_style_pad_all(cont, 12, 0);
+    lv_obj_set_style_pad_gap(cont, 12, 0);
+
+    uint32_t i;
+    for(i = 0; i < CARD_CNT; i++) {
+        lv_obj_t * card = lv_obj_create(cont);
+        lv_obj_set_size(card, 60, 40);
+        lv_obj_set_style_radius(card, 8, 0);
+        lv_obj_set_style_shadow_width(card, i % 3 == 0 ? 20 : 12, 0);
+        lv_obj_set_style_shadow_offset_y(card, 4, 0);
+        lv_obj_set_style_shadow_opa(card, LV_OPA_40, 0);
+        lv_obj_remove_flag(card, LV_OBJ_FLAG_SCROLLABLE);
+
+        lv_obj_t * label = lv_label_create(card);
+        lv_label_set_text_fmt(label, "%" LV_PRIu32, i + 1);
+        lv_obj_center(label);
+    }
+
+    lv_refr_now(NULL);
+
+    uint32_t t = lv_tick_get();
+    for(i = 0; i < MEASURE_CNT; i++) {
+        lv_obj_invalidate(lv_screen_active());
+        lv_refr_now(NULL);
+    }
+    uint32_t elaps = lv_tick_elaps(t);
+
+    LV_LOG_USER("%d cards: %" LV_PRIu32 ".%" LV_PRIu32 " ms per refresh", CARD_CNT,
+                elaps / MEASURE_CNT, (elaps * 10 / MEASURE_CNT) % 10);
+    LV_UNUSED(elaps);
+}
+
+#endif
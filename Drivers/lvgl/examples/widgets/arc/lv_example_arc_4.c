@@ -0,0 +1,43 @@
+#include "../../lv_examples.h"
+#if LV_USE_ARC && LV_USE_LABEL && LV_BUILD_EXAMPLES
+
+#define MEASURE_CNT     100
+
+/**
+ * Create a large gauge and redraw it with a different value in every frame.
+ * Log the time of the refreshes.
+ * Compare the results with `LV_DRAW_SW_ARC_SPANS 0`.
+ */
+void lv_example_arc_4(void)
+{
+    lv_obj_t * arc = lv_arc_create(lv_screen_active());
+    lv_obj_set_size(arc, 200, 200);
+    lv_obj_set_style_arc_width(arc, 24, LV_PART_MAIN);
+    lv_obj_set_style_arc_width(arc, 24, LV_PART_INDICATOR);
+    lv_obj_remove_style(arc, NULL, LV_PART_KNOB);
+    lv_obj_remove_flag(arc, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_center(arc);
+
+    lv_obj_t * label = lv_label_create(arc);
+    lv_obj_center(label);
+
+    lv_refr_now(NULL);
+
+    uint32_t t = lv_tick_get();
+    uint32_t i;
+    for(i = 0; i < MEASURE_CNT; i++) {
+        int32_t v = (int32_t)(i % 100);
+        lv_arc_set_value(arc, v);
+        lv_label_set_text_fmt(label, "%" LV_PRId32 " %%", v);
+
+        /*Redraw the whole gauge, not only the changed part*/
+        lv_obj_invalidate(arc);
+        lv_refr_now(NULL);
+    }
+    uint32_t elaps = lv_tick_elaps(t);
+
+    LV_LOG_USER("%d refreshes: %" LV_PRIu32 " ms", MEASURE_CNT, elaps);
+    LV_UNUSED(elaps);
+}
+
+#endif
@@ -0,0 +1,52 @@
+#include "../../lv_examples.h"
+#if LV_USE_CHART && LV_BUILD_EXAMPLES
+
+#define POINT_CNT       200
+#define SERIES_CNT      3
+#define MEASURE_CNT     50
+
+/**
+ * Redraw a line chart with 3 series of 200 points in every frame.
+ * Log the time of the refreshes.
+ * Compare the results with `LV_DRAW_SW_POLYLINE 0`.
+ */
+void lv_example_chart_10(void)
+{
+    lv_obj_t * chart = lv_chart_create(lv_screen_active());
+    lv_obj_set_size(chart, lv_pct(100), lv_pct(100));
+    lv_obj_set_style_size(chart, 0, 0, LV_PART_INDICATOR);
+    lv_chart_set_point_count(chart, POINT_CNT);
+
+    static const lv_palette_t palettes[SERIES_CNT] = {LV_PALETTE_RED, LV_PALETTE_GREEN, LV_PALETTE_BLUE};
+    uint32_t s;
+    for(s = 0; s < SERIES_CNT; s++) {
+        lv_chart_add_series(chart, lv_palette_main(palettes[s]), LV_CHART_AXIS_PRIMARY_Y);
+    }
+
+    lv_refr_now(NULL);
+
+    uint32_t t = lv_tick_get();
+    uint32_t i;
+    for(i = 0; i < MEASURE_CNT; i++) {
+        /*Moving sine waves with some noise*/
+        lv_chart_series_t * ser = lv_chart_get_series_next(chart, NULL);
+        for(s = 0; ser; s++) {
+            uint32_t p;
+            for(p = 0; p < POINT_CNT; p++) {
+                int32_t angle = (int32_t)((p * 4 + i * 8 + s * 120) % 360);
+                int32_t v = 50 + lv_trigo_sin((int16_t)angle) * 40 / LV_TRIGO_SIN_MAX + (int32_t)lv_rand(0, 5);
+                lv_chart_set_series_value_by_id(chart, ser, p, v);
+            }
+            ser = lv_chart_get_series_next(chart, ser);
+        }
+
+        lv_chart_refresh(chart);
+        lv_refr_now(NULL);
+    }
+    uint32_t elaps = lv_tick_elaps(t);
+
+    LV_LOG_USER("%d refreshes: %" LV_PRIu32 " ms", MEASURE_CNT, elaps);
+    LV_UNUSED(elaps);
+}
+
+#endif
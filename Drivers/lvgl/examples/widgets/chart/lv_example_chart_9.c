@@ -0,0 +1,45 @@
+#include "../../lv_examples.h"
+#if LV_USE_CHART && LV_BUILD_EXAMPLES
+
+#define CHART_CONTENT_W     200
+#define CHART_CONTENT_H     100
+#define POINT_CNT           41      /*(CHART_CONTENT_W / (POINT_CNT - 1)) is an integer*/
+
+static void add_data(lv_timer_t * t)
+{
+    lv_obj_t * chart = lv_timer_get_user_data(t);
+    lv_chart_series_t * ser = lv_chart_get_series_next(chart, NULL);
+
+    static uint32_t cnt;
+    int32_t v = (int32_t)(cnt % 40);
+    if(v > 20) v = 40 - v;
+    lv_chart_set_next_value(chart, ser, 30 + v * 2 + (int32_t)lv_rand(0, 10));
+    cnt++;
+}
+
+/**
+ * A shifting line chart updated 50 times per second.
+ * The plot area is rendered into a buffer once and then only the new points are
+ * rendered and the rest is shifted, instead of drawing all the lines in every frame.
+ */
+void lv_example_chart_9(void)
+{
+    LV_DRAW_BUF_DEFINE_STATIC(stream_buf, CHART_CONTENT_W, CHART_CONTENT_H, LV_COLOR_FORMAT_NATIVE);
+    LV_DRAW_BUF_INIT_STATIC(stream_buf);
+
+    lv_obj_t * chart = lv_chart_create(lv_screen_active());
+    lv_obj_set_style_pad_all(chart, 10, 0);
+    lv_obj_set_style_border_width(chart, 0, 0);
+    lv_obj_set_size(chart, CHART_CONTENT_W + 20, CHART_CONTENT_H + 20);
+    lv_obj_center(chart);
+    lv_obj_set_style_size(chart, 0, 0, LV_PART_INDICATOR);
+
+    lv_chart_set_point_count(chart, POINT_CNT);
+    lv_chart_set_update_mode(chart, LV_CHART_UPDATE_MODE_SHIFT);
+    lv_chart_set_stream_buffer(chart, &stream_buf);
+    lv_chart_add_series(chart, lv_palette_main(LV_PALETTE_BLUE), LV_CHART_AXIS_PRIMARY_Y);
+
+    lv_timer_create(add_data, 20, chart);
+}
+
+#endif
@@ -0,0 +1,41 @@
+#include "../../lv_examples.h"
+#if LV_USE_IMAGE && LV_BUILD_EXAMPLES
+
+#define FRAME_CNT       72
+
+static void measure(lv_obj_t * img, bool antialias)
+{
+    lv_image_set_antialias(img, antialias);
+
+    uint32_t t = lv_tick_get();
+    uint32_t i;
+    for(i = 0; i < FRAME_CNT; i++) {
+        lv_image_set_rotation(img, (int32_t)(i * 3600 / FRAME_CNT) + 7);
+        lv_refr_now(NULL);
+    }
+    uint32_t elaps = lv_tick_elaps(t);
+
+    LV_LOG_USER("%s: %" LV_PRIu32 ".%" LV_PRIu32 " ms per frame", antialias ? "bilinear" : "nearest",
+                elaps / FRAME_CNT, (elaps * 10 / FRAME_CNT) % 10);
+    LV_UNUSED(elaps);
+}
+
+/**
+ * Spin an RGB565 image scaled to 200x200 pixels and log the time of a frame
+ * with and without anti-aliasing.
+ * Compare the results with `LV_DRAW_SW_TRANSFORM_FAST_RGB565 0`.
+ */
+void lv_example_image_6(void)
+{
+    LV_IMAGE_DECLARE(img_cogwheel_rgb);
+
+    lv_obj_t * img = lv_image_create(lv_screen_active());
+    lv_image_set_src(img, &img_cogwheel_rgb);
+    lv_image_set_scale(img, 512);
+    lv_obj_center(img);
+
+    measure(img, true);
+    measure(img, false);
+}
+
+#endif
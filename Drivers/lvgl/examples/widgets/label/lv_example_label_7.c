@@ -0,0 +1,60 @@
+#include "../../lv_examples.h"
+#if LV_USE_LABEL && LV_FONT_SOURCE_HAN_SANS_SC_16_CJK && LV_BUILD_EXAMPLES
+
+#define CHAR_CNT        2000
+#define MEASURE_CNT     20
+
+static const char base_text[] =
+    "嵌入式系统是一种专用的计算机系统，作为装置或设备的一部分。通常，嵌入式系统是一个控制程序存储在"
+    "只读存储器中的嵌入式处理器控制板。事实上，所有带有数字接口的设备，如手表、微波炉、录像机、汽车等，"
+    "都使用嵌入式系统，有些嵌入式系统还包含操作系统，但大多数嵌入式系统都是由单个程序实现整个控制逻辑。";
+
+/**
+ * Measure and render a 2000 character long Chinese paragraph.
+ * Every character is looked up in the large sparse character map of the font
+ * both while measuring and while rendering the text.
+ * Compare the logged times with `LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE 0`
+ * and without `lv_font_fmt_txt_create_index()`.
+ */
+void lv_example_label_7(void)
+{
+    const lv_font_t * font = &lv_font_source_han_sans_sc_16_cjk;
+    lv_font_fmt_txt_create_index(font);
+
+    /*Repeat the base text until it has CHAR_CNT characters. All of its characters are encoded on 3 bytes.*/
+    uint32_t base_size = sizeof(base_text) - 1;
+    uint32_t text_size = CHAR_CNT * 3;
+    char * text = lv_malloc(text_size + 1);
+    LV_ASSERT_MALLOC(text);
+    if(text == NULL) return;
+
+    uint32_t i;
+    for(i = 0; i < text_size; i += base_size) {
+        lv_memcpy(&text[i], base_text, LV_MIN(base_size, text_size - i));
+    }
+    text[text_size] = '\0';
+
+    lv_obj_t * label = lv_label_create(lv_screen_active());
+    lv_obj_set_width(label, lv_pct(100));
+    lv_obj_set_style_text_font(label, font, 0);
+
+    uint32_t t = lv_tick_get();
+    lv_point_t size;
+    for(i = 0; i < MEASURE_CNT; i++) {
+        lv_text_get_size(&size, text, font, 0, 0, lv_obj_get_content_width(label), LV_TEXT_FLAG_NONE);
+    }
+    uint32_t measure_time = lv_tick_elaps(t);
+
+    /*The label copies the text*/
+    lv_label_set_text(label, text);
+    lv_free(text);
+
+    t = lv_tick_get();
+    lv_refr_now(NULL);
+    uint32_t render_time = lv_tick_elaps(t);
+
+    LV_LOG_USER("%d characters: %" LV_PRIu32 " ms to measure %d times, %" LV_PRIu32 " ms to render",
+                CHAR_CNT, measure_time, MEASURE_CNT, render_time);
+}
+
+#endif
@@ -30,6 +30,7 @@ void lv_example_animimg_1(void);
 void lv_example_arc_1(void);
 void lv_example_arc_2(void);
 void lv_example_arc_3(void);
+void lv_example_arc_4(void);
 
 void lv_example_arclabel_1(void);
 
@@ -72,6 +73,8 @@ void lv_example_chart_5(void);
 void lv_example_chart_6(void);
 void lv_example_chart_7(void);
 void lv_example_chart_8(void);
+void lv_example_chart_9(void);
+void lv_example_chart_10(void);
 
 void lv_example_checkbox_1(void);
 void lv_example_checkbox_2(void);
@@ -85,6 +88,7 @@ void lv_example_image_2(void);
 void lv_example_image_3(void);
 void lv_example_image_4(void);
 void lv_example_image_5(void);
+void lv_example_image_6(void);
 
 void lv_example_imagebutton_1(void);
 
@@ -98,6 +102,7 @@ void lv_example_label_3(void);
 void lv_example_label_4(void);
 void lv_example_label_5(void);
 void lv_example_label_6(void);
+void lv_example_label_7(void);
 
 void lv_example_led_1(void);
 
@@ -155,6 +160,7 @@ void lv_example_switch_2(void);
 
 void lv_example_table_1(void);
 void lv_example_table_2(void);
+void lv_example_table_3(void);
 
 void lv_example_tabview_1(void);
 void lv_example_tabview_2(void);
@@ -0,0 +1,60 @@
+#include "../../lv_examples.h"
+#if LV_USE_TABLE && LV_BUILD_EXAMPLES
+
+#define ROW_CNT         40
+#define COL_CNT         3
+#define MEASURE_CNT     50
+
+/**
+ * Redraw a full screen table in every frame and log the number of draw tasks
+ * of the last refresh and how many of them were merged, dropped and reordered.
+ * The cells have the same color without borders, so their fills touch each other and cover the table's background.
+ * Enable `LV_DRAW_OPTIMIZE_TASKS` (e.g. 64) to see the effect of the optimization.
+ */
+void lv_example_table_3(void)
+{
+    lv_obj_t * table = lv_table_create(lv_screen_active());
+    lv_obj_set_size(table, lv_pct(100), lv_pct(100));
+    lv_obj_set_style_radius(table, 0, 0);
+    lv_obj_set_style_border_width(table, 0, 0);
+    lv_obj_set_style_pad_all(table, 0, 0);
+    lv_obj_set_style_border_width(table, 0, LV_PART_ITEMS);
+    lv_obj_set_style_pad_ver(table, 4, LV_PART_ITEMS);
+    lv_obj_set_style_bg_color(table, lv_palette_lighten(LV_PALETTE_GREY, 4), LV_PART_ITEMS);
+
+    lv_table_set_row_count(table, ROW_CNT);
+    lv_table_set_column_count(table, COL_CNT);
+
+    int32_t col_w = lv_obj_get_content_width(lv_screen_active()) / COL_CNT;
+    uint32_t row;
+    uint32_t col;
+    for(col = 0; col < COL_CNT; col++) {
+        lv_table_set_column_width(table, col, col_w);
+    }
+
+    for(row = 0; row < ROW_CNT; row++) {
+        for(col = 0; col < COL_CNT; col++) {
+            lv_table_set_cell_value_fmt(table, row, col, "%" LV_PRIu32 ":%" LV_PRIu32, row, col);
+        }
+    }
+
+    lv_refr_now(NULL);
+
+    uint32_t t = lv_tick_get();
+    uint32_t i;
+    for(i = 0; i < MEASURE_CNT; i++) {
+        lv_obj_invalidate(table);
+        lv_refr_now(NULL);
+    }
+    uint32_t elaps = lv_tick_elaps(t);
+
+    lv_refr_stats_t stats;
+    lv_refr_get_stats(NULL, &stats);
+    LV_LOG_USER("%d refreshes: %" LV_PRIu32 " ms", MEASURE_CNT, elaps);
+    LV_UNUSED(elaps);
+    LV_LOG_USER("draw tasks per refresh: %" LV_PRIu32 " added, %" LV_PRIu32 " merged, %" LV_PRIu32 " dropped, %"
+                LV_PRIu32 " reordered, %" LV_PRIu32 " drawn", stats.task_cnt, stats.task_merged, stats.task_dropped,
+                stats.task_reordered, stats.task_cnt - stats.task_merged - stats.task_dropped);
+}
+
+#endif
@@ -76,6 +76,12 @@
     /** Size of the memory expand for `lv_malloc()` in bytes */
     #define LV_MEM_POOL_EXPAND_SIZE 0
 
+    /** Size of a second memory pool for large buffers in bytes: draw buffers, decoded images and layers (0: unused).
+     *  This way the `LV_MEM_SIZE` pool can be in a small but fast memory for widgets and styles,
+     *  and the large buffers can be in a larger RAM. If one of the pools is full the other one is used too.
+     *  More pools can be added by `lv_mem_add_region_pool()`. */
+    #define LV_MEM_LARGE_SIZE (112 * 1024U)          /**< [bytes] */
+
     /** Set an address for the memory pool instead of allocating it as a normal array. Can be in external SRAM too. */
     #define LV_MEM_ADR 0     /**< 0: unused*/
     /* Instead of an address give a memory allocator that will be called to get a memory pool for LVGL. E.g. my_malloc */
@@ -92,10 +98,32 @@
 /** Default display refresh, input device read and animation step period. */
 #define LV_DEF_REFR_PERIOD  33      /**< [ms] */
 
+/** Keep the running timers in a binary heap ordered by their next run.
+ *  `lv_timer_handler()` visits only the due timers instead of all of them,
+ *  and creating or deleting timers in a timer callback doesn't restart the iteration. */
+#define LV_USE_TIMER_HEAP 1
+
 /** Default Dots Per Inch. Used to initialize default sizes such as widgets sized, style paddings.
  * (Not so important, you can adjust it to modify default sizes and spaces.) */
 #define LV_DPI_DEF 130              /**< [px/inch] */
 
+/** When the `LV_INV_BUF_SIZE` long list of invalidated areas overflows, collect the areas
+ *  in a bit-per-tile dirty map instead of redrawing the whole screen.
+ *  The dirty tiles are merged into rectangles at refresh time. (Not used in `LV_DISPLAY_RENDER_MODE_FULL`) */
+#define LV_USE_REFR_TILE_MAP 1
+#if LV_USE_REFR_TILE_MAP
+    /** Width and height of a tile in pixels. 8, 16 or 32 */
+    #define LV_REFR_TILE_MAP_TILE_SIZE 8
+#endif
+
+/** Before rendering a band collect the areas fully covered by opaque widgets
+ *  and skip drawing the widgets (or their main part) which are hidden by them. */
+#define LV_USE_REFR_OCCLUSION 1
+#if LV_USE_REFR_OCCLUSION
+    /** Maximum number of opaque areas collected per band */
+    #define LV_REFR_OCCLUSION_MAX 16
+#endif
+
 /*=================
  * OPERATING SYSTEM
  *=================*/
@@ -153,6 +181,18 @@
  * Set it to 0 to have no limit. */
 #define LV_DRAW_LAYER_MAX_MEMORY 0  /**< No limit by default [bytes]*/
 
+/* Allocate the layer buffers from a bump allocator instead of `lv_malloc()`.
+ * The arena is reset when all of its layers are drawn, so it needs no freeing and doesn't fragment.
+ * If a layer doesn't fit into the arena it's allocated by `lv_draw_buf_create()`.
+ * Use `LV_ATTRIBUTE_DRAW_LAYER_ARENA` to place it into a given RAM. 0: disable the arena */
+#define LV_DRAW_LAYER_ARENA_SIZE 0   /**< [bytes]*/
+
+/* Keep the draw tasks of a layer until it's drawn and optimize them in one pass before dispatching:
+ * touching opaque fills with the same color are merged, tasks covered by a later opaque fill are dropped and
+ * independent tasks of the same type are moved next to each other. The output doesn't change.
+ * The tasks are kept in memory longer, so at most this many tasks are collected before drawing them. 0: disable */
+#define LV_DRAW_OPTIMIZE_TASKS 0
+
 /** Stack size of drawing thread.
  * NOTE: If FreeType or ThorVG is enabled, it is recommended to set it to 32KB or more.
  */
@@ -210,14 +250,19 @@
     #if LV_DRAW_SW_COMPLEX == 1
         /** Allow buffering some shadow calculation.
          *  LV_DRAW_SW_SHADOW_CACHE_SIZE is the maximum shadow size to buffer, where shadow size is
-         *  `shadow_width + radius`.  Caching has LV_DRAW_SW_SHADOW_CACHE_SIZE^2 RAM cost. */
-        #define LV_DRAW_SW_SHADOW_CACHE_SIZE 0
+         *  `shadow_width + radius`.  Caching a shadow has `shadow size`^2 RAM cost.
+         *  The blurred corners of the recently used shadows are kept until they use
+         *  LV_DRAW_SW_SHADOW_CACHE_MEMORY bytes, then the least recently used ones are dropped. */
+        #define LV_DRAW_SW_SHADOW_CACHE_SIZE 48
+
+        /** Max memory for the cached shadow corners [bytes] */
+        #define LV_DRAW_SW_SHADOW_CACHE_MEMORY (8 * 1024)
 
         /** Set number of maximally-cached circle data.
          *  The circumference of 1/4 circle are saved for anti-aliasing.
          *  `radius * 4` bytes are used per circle (the most often used radiuses are saved).
          *  - 0: disables caching */
-        #define LV_DRAW_SW_CIRCLE_CACHE_SIZE 4
+        #define LV_DRAW_SW_CIRCLE_CACHE_SIZE 8
     #endif
 
     #define  LV_USE_DRAW_SW_ASM     LV_DRAW_SW_ASM_NONE
@@ -229,6 +274,18 @@
     /** Enable drawing complex gradients in software: linear at an angle, radial or conical */
     #define LV_USE_DRAW_SW_COMPLEX_GRADIENTS    0
 
+    /** Rotate RGB565 and RGB565A8 images with a dedicated renderer which steps the image coordinates incrementally
+     *  and skips the pixels which are out of the image. */
+    #define LV_DRAW_SW_TRANSFORM_FAST_RGB565    1
+
+    /** Draw the arcs row by row in parts. The hole of the ring and the parts out of the angle range
+     *  are skipped without calculating their masks. */
+    #define LV_DRAW_SW_ARC_SPANS    1
+
+    /** Draw the lines of charts and line widgets with one draw task per polyline instead of one task per segment.
+     *  The joints of opaque lines wider than 2 px are rounded. Not used if the widget sends draw task events. */
+    #define LV_DRAW_SW_POLYLINE     1
+
 #endif
 
 /*Use TSi's aka (Think Silicon) NemaGFX */
@@ -466,6 +523,12 @@
  *  The main logic is like `LV_CACHE_DEF_SIZE` but for image headers. */
 #define LV_IMAGE_HEADER_CACHE_DEF_CNT 0
 
+/** Default number of images whose alpha channel analysis is cached.
+ *  RGB565A8 and ARGB8888 images are split into tiles which are marked as fully opaque, fully transparent or mixed
+ *  when the image is opened first. Opaque tiles are copied without blending and transparent tiles are skipped.
+ *  Only constant images are analyzed (not `LV_IMAGE_FLAGS_MODIFIABLE`). 0 to disable. */
+#define LV_IMAGE_ALPHA_CACHE_DEF_CNT 4
+
 /** Number of stops allowed per gradient. Increase this to allow more stops.
  *  This adds (sizeof(lv_color_t) + 1) bytes per additional stop. */
 #define LV_GRADIENT_MAX_STOPS   2
@@ -481,6 +544,12 @@
 /** Add 2 x 32-bit variables to each `lv_obj_t` to speed up getting style properties */
 #define LV_OBJ_STYLE_CACHE      0
 
+/** Number of lines in the cache of the resolved style properties used while drawing (power of 2, 0: disable).
+ *  A line stores the values of 32 frequently used properties of a part of a widget in its current state.
+ *  Adds a 32-bit variable to each `lv_obj_t`. About 150 bytes per line on 32-bit MCUs.
+ *  With too few lines the values are overwritten before they are used again on a screen of many widgets. */
+#define LV_OBJ_STYLE_RESOLVED_CACHE_LINES   0
+
 /** Add `id` field to `lv_obj_t` */
 #define LV_USE_OBJ_ID           0
 
@@ -562,6 +631,12 @@
 /** Compiler prefix for a large array declaration in RAM */
 #define LV_ATTRIBUTE_LARGE_RAM_ARRAY
 
+/** Compiler prefix for the `LV_MEM_LARGE_SIZE` memory pool, e.g. to place it in a linker section */
+#define LV_ATTRIBUTE_MEM_LARGE __attribute__((section(".ram_d1_noinit"), aligned(8)))
+
+/** Compiler prefix for the `LV_DRAW_LAYER_ARENA_SIZE` layer buffer arena */
+#define LV_ATTRIBUTE_DRAW_LAYER_ARENA __attribute__((section(".ram_d1_noinit"), aligned(8)))
+
 /** Place performance critical functions into a faster memory (e.g RAM) */
 #define LV_ATTRIBUTE_FAST_MEM
 
@@ -646,6 +721,16 @@
 /** Enables/disables support for compressed fonts. */
 #define LV_USE_FONT_COMPRESSED 0
 
+/** Number of entries in the direct-mapped cache of the code point -> glyph ID lookups of built-in fonts.
+ *  Speeds up fonts with many or sparse character maps (e.g. CJK fonts) where every lookup needs a binary search.
+ *  Must be a power of 2. 0: disable the cache. */
+#define LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE 128
+
+/** Size of the cache of the rendered A8 bitmaps of built-in and binary font glyphs [bytes].
+ *  Labels drawn in multiple bands and redrawn texts don't need to decompress or convert the glyphs again.
+ *  0: disable the cache. */
+#define LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE (12 * 1024U)
+
 /** Enable drawing placeholders when glyph dsc is not found. */
 #define LV_USE_FONT_PLACEHOLDER 1
 
@@ -756,6 +841,7 @@
     #define LV_LABEL_TEXT_SELECTION 1   /**< Enable selecting text of the label */
     #define LV_LABEL_LONG_TXT_HINT 1    /**< Store some extra info in labels to speed up drawing of very long text */
     #define LV_LABEL_WAIT_CHAR_COUNT 3  /**< The count of wait chart */
+    #define LV_LABEL_LINE_CACHE 1       /**< Store the line breaks and line widths of the text to not measure unchanged texts again */
 #endif
 
 #define LV_USE_LED        1
@@ -838,6 +924,10 @@
 /** A layout similar to Grid in CSS. */
 #define LV_USE_GRID 1
 
+/** Keep track of the containers having descendants with invalid layout.
+ *  Updating the layout visits only these branches instead of every widget of the screen. */
+#define LV_LAYOUT_DIRTY_SUBTREE 1
+
 /*====================
  * 3RD PARTS LIBRARIES
  *====================*/
@@ -944,7 +1034,7 @@
 #define LV_BIN_DECODER_RAM_LOAD 0
 
 /** RLE decompress library */
-#define LV_USE_RLE 0
+#define LV_USE_RLE 1
 
 /** QR code library */
 #define LV_USE_QRCODE 0
@@ -986,7 +1076,7 @@
 #define LV_USE_THORVG_EXTERNAL 0
 
 /** Use lvgl built-in LZ4 lib */
-#define LV_USE_LZ4_INTERNAL  0
+#define LV_USE_LZ4_INTERNAL  1
 
 /** Use external LZ4 library */
 #define LV_USE_LZ4_EXTERNAL  0
@@ -1015,7 +1105,15 @@
 /* Documentation for several of the below items can be found here: https://docs.lvgl.io/master/details/auxiliary-modules/index.html . */
 
 /** 1: Enable API to take snapshot for object */
-#define LV_USE_SNAPSHOT 0
+#define LV_USE_SNAPSHOT 1
+
+/** 1: Keep the rendered image of widgets marked with `lv_obj_set_render_cache()`
+ *  and blit it instead of redrawing the widget and its children. Requires `LV_USE_SNAPSHOT`. */
+#define LV_USE_OBJ_RENDER_CACHE 1
+#if LV_USE_OBJ_RENDER_CACHE
+    /** Maximum memory used by the cached images. The least recently used ones are dropped first. */
+    #define LV_OBJ_RENDER_CACHE_SIZE (16 * 1024)   /**< [bytes] */
+#endif
 
 /** 1: Enable system monitor component */
 #define LV_USE_SYSMON   0
@@ -0,0 +1,292 @@
+#!/usr/bin/env python3
+"""
+Convert an LVGL C array image (e.g. generated by GUI Guider or LVGLImage.py) to a
+block compressed image.
+
+The rows of the image are split into blocks of `--block-rows` rows and each block is
+compressed on its own with RLE or LZ4. An index of the blocks is stored in front of
+them, so that LVGL's binary decoder can decompress only the blocks which intersect
+the currently rendered area into a small buffer (`LV_IMAGE_COMPRESS_RLE_BLOCKS` and
+`LV_IMAGE_COMPRESS_LZ4_BLOCKS`).
+
+Layout of the data array:
+    uint32_t method:4, reserved:28     # lv_image_compressed_t
+    uint32_t compressed_size           # size of everything below
+    uint32_t decompressed_size         # size of the raw image data
+    uint16_t block_h                   # rows in a block
+    uint16_t block_cnt
+    uint32_t offsets[block_cnt + 1]    # start of the blocks after the offset table
+    uint8_t  blocks[]
+
+Usage:
+    image_block_compress.py _laoda_RGB565A8_240x240.c -o laoda_lz4.c --method lz4 --block-rows 10
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+COMPRESS_RLE_BLOCKS = 3
+COMPRESS_LZ4_BLOCKS = 4
+
+# Bits per pixel of the supported color formats
+COLOR_FORMAT_BPP = {
+    "LV_COLOR_FORMAT_L8": 8,
+    "LV_COLOR_FORMAT_A1": 1,
+    "LV_COLOR_FORMAT_A2": 2,
+    "LV_COLOR_FORMAT_A4": 4,
+    "LV_COLOR_FORMAT_A8": 8,
+    "LV_COLOR_FORMAT_AL88": 16,
+    "LV_COLOR_FORMAT_RGB565": 16,
+    "LV_COLOR_FORMAT_RGB565_SWAPPED": 16,
+    "LV_COLOR_FORMAT_ARGB8565": 24,
+    "LV_COLOR_FORMAT_RGB565A8": 16,
+    "LV_COLOR_FORMAT_RGB888": 24,
+    "LV_COLOR_FORMAT_ARGB8888": 32,
+    "LV_COLOR_FORMAT_XRGB8888": 32,
+}
+
+
+def rle_compress(data, blk_size):
+    """Compress in the format of `lv_rle_decompress()`."""
+    if len(data) % blk_size:
+        data = data + bytes(blk_size - len(data) % blk_size)
+
+    blks = [data[i:i + blk_size] for i in range(0, len(data), blk_size)]
+    out = bytearray()
+    i = 0
+    n = len(blks)
+    while i < n:
+        run = 1
+        while i + run < n and run < 127 and blks[i + run] == blks[i]:
+            run += 1
+
+        if run >= 2:
+            out.append(run)
+            out += blks[i]
+            i += run
+            continue
+
+        # Collect literals until a repetition starts
+        start = i
+        while i < n and i - start < 127:
+            if i + 1 < n and blks[i + 1] == blks[i]:
+                break
+            i += 1
+        if i == start:
+            i += 1
+        out.append(0x80 | (i - start))
+        for b in blks[start:i]:
+            out += b
+
+    return bytes(out)
+
+
+def lz4_compress(data):
+    """Greedy LZ4 block compressor, the output can be decoded by `LZ4_decompress_safe()`."""
+    MIN_MATCH = 4
+    LAST_LITERALS = 5
+    MF_LIMIT = 12
+
+    n = len(data)
+    out = bytearray()
+
+    def write_len(value):
+        while value >= 255:
+            out.append(255)
+            value -= 255
+        out.append(value)
+
+    def write_sequence(literals, match_len, offset):
+        lit_len = len(literals)
+        token = (min(lit_len, 15) << 4)
+        if match_len is not None:
+            token |= min(match_len - MIN_MATCH, 15)
+        out.append(token)
+        if lit_len >= 15:
+            write_len(lit_len - 15)
+        out.extend(literals)
+        if match_len is not None:
+            out.extend(struct.pack("<H", offset))
+            if match_len - MIN_MATCH >= 15:
+                write_len(match_len - MIN_MATCH - 15)
+
+    table = {}
+    anchor = 0
+    i = 0
+    match_limit = n - MF_LIMIT
+    while i < match_limit:
+        key = data[i:i + MIN_MATCH]
+        ref = table.get(key)
+        table[key] = i
+        if ref is None or i - ref > 0xFFFF:
+            i += 1
+            continue
+
+        length = MIN_MATCH
+        max_len = n - LAST_LITERALS - i
+        while length < max_len and data[ref + length] == data[i + length]:
+            length += 1
+
+        write_sequence(data[anchor:i], length, i - ref)
+        i += length
+        anchor = i
+
+    write_sequence(data[anchor:], None, 0)
+    return bytes(out)
+
+
+def parse_c_array(text):
+    m = re.search(r"uint8_t\s+(\w+)\s*\[\s*\]\s*=\s*\{(.*?)\};", text, re.S)
+    if not m:
+        sys.exit("No uint8_t array found")
+    values = re.findall(r"0x[0-9a-fA-F]+|\d+", m.group(2))
+    data = bytes(int(v, 0) & 0xFF for v in values)
+
+    def field(name):
+        f = re.search(r"\.header\." + name + r"\s*=\s*(\w+)", text)
+        if not f:
+            sys.exit("No .header.%s found" % name)
+        return f.group(1)
+
+    dsc = re.search(r"lv_image_dsc_t\s+(\w+)\s*=", text)
+    return {
+        "map_name": m.group(1),
+        "dsc_name": dsc.group(1) if dsc else m.group(1).replace("_map", ""),
+        "data": data,
+        "cf": field("cf"),
+        "w": int(field("w"), 0),
+        "h": int(field("h"), 0),
+        "stride": int(field("stride"), 0),
+    }
+
+
+def split_blocks(img, block_rows):
+    """Return the raw blocks. RGB565A8 blocks contain their RGB565 rows followed by their A8 rows."""
+    data = img["data"]
+    h = img["h"]
+    stride = img["stride"]
+    blocks = []
+    for y in range(0, h, block_rows):
+        rows = min(block_rows, h - y)
+        block = data[y * stride:(y + rows) * stride]
+        if img["cf"] == "LV_COLOR_FORMAT_RGB565A8":
+            a_stride = stride // 2
+            a_start = h * stride
+            block += data[a_start + y * a_stride:a_start + (y + rows) * a_stride]
+        blocks.append(block)
+    return blocks
+
+
+def compress(img, method, block_rows):
+    cf = img["cf"]
+    if cf not in COLOR_FORMAT_BPP:
+        sys.exit("Color format %s is not supported" % cf)
+
+    expected = img["stride"] * img["h"]
+    if cf == "LV_COLOR_FORMAT_RGB565A8":
+        expected += img["stride"] // 2 * img["h"]
+    if len(img["data"]) < expected:
+        sys.exit("The array is %d bytes but %d bytes are expected" % (len(img["data"]), expected))
+
+    if cf == "LV_COLOR_FORMAT_RGB565A8":
+        blk_size = 2
+    else:
+        blk_size = (COLOR_FORMAT_BPP[cf] + 7) // 8
+
+    packed = []
+    for block in split_blocks(img, block_rows):
+        packed.append(rle_compress(block, blk_size) if method == "rle" else lz4_compress(block))
+
+    offsets = [0]
+    for p in packed:
+        offsets.append(offsets[-1] + len(p))
+
+    payload = struct.pack("<HH", block_rows, len(packed))
+    payload += struct.pack("<%dI" % len(offsets), *offsets)
+    payload += b"".join(packed)
+
+    method_id = COMPRESS_RLE_BLOCKS if method == "rle" else COMPRESS_LZ4_BLOCKS
+    return struct.pack("<III", method_id, len(payload), expected) + payload
+
+
+def write_c(img, out_data, out_path, name):
+    map_name = name + "_map"
+    attr = "LV_ATTRIBUTE_IMAGE_" + name.upper()
+    lines = []
+    lines.append("""#ifdef __has_include
+    #if __has_include("lvgl.h")
+        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
+            #define LV_LVGL_H_INCLUDE_SIMPLE
+        #endif
+    #endif
+#endif
+
+#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
+    #include "lvgl.h"
+#else
+    #include "lvgl/lvgl.h"
+#endif
+
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+#define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef %(attr)s
+#define %(attr)s
+#endif
+
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST %(attr)s uint8_t %(map)s[] = {""" % {"attr": attr, "map": map_name})
+
+    for i in range(0, len(out_data), 16):
+        lines.append("  " + ", ".join("0x%02x" % b for b in out_data[i:i + 16]) + ",")
+
+    lines.append("""};
+
+const lv_image_dsc_t %(name)s = {
+  .header.magic = LV_IMAGE_HEADER_MAGIC,
+  .header.cf = %(cf)s,
+  .header.flags = LV_IMAGE_FLAGS_COMPRESSED,
+  .header.stride = %(stride)d,
+  .header.w = %(w)d,
+  .header.h = %(h)d,
+  .data_size = sizeof(%(map)s),
+  .data = %(map)s,
+};
+""" % {"name": name, "cf": img["cf"], "stride": img["stride"], "w": img["w"], "h": img["h"], "map": map_name})
+
+    with open(out_path, "w") as f:
+        f.write("\n".join(lines))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compress an LVGL C array image in independent row blocks")
+    parser.add_argument("input", help="C file with an lv_image_dsc_t and its uint8_t map")
+    parser.add_argument("-o", "--output", help="output C file (default: <input>_<method>.c)")
+    parser.add_argument("--method", choices=["rle", "lz4"], default="lz4")
+    parser.add_argument("--block-rows", type=int, default=10,
+                        help="rows in a block, ideally the height of the render buffer or its divisor (default: 10)")
+    parser.add_argument("--name", help="name of the lv_image_dsc_t (default: same as in the input)")
+    args = parser.parse_args()
+
+    if args.block_rows < 1 or args.block_rows > 0xFFFF:
+        sys.exit("Invalid block rows")
+
+    with open(args.input) as f:
+        img = parse_c_array(f.read())
+
+    out_data = compress(img, args.method, args.block_rows)
+    name = args.name or img["dsc_name"]
+    out_path = args.output or os.path.splitext(args.input)[0] + "_" + args.method + ".c"
+    write_c(img, out_data, out_path, name)
+
+    raw = len(img["data"])
+    print("%s: %d -> %d bytes (%.1f%%), %d rows per block" %
+          (name, raw, len(out_data), 100.0 * len(out_data) / raw, args.block_rows))
+
+
+if __name__ == "__main__":
+    main()
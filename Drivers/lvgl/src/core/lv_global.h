@@ -31,9 +31,7 @@ extern "C" {
 #include "../others/sysmon/lv_sysmon.h"
 #include "../stdlib/builtin/lv_tlsf.h"
 
-#if LV_USE_FONT_COMPRESSED
 #include "../font/lv_font_fmt_txt_private.h"
-#endif
 
 #if LV_USE_OS != LV_OS_NONE && defined(__linux__)
 #include "../osal/lv_linux_private.h"
@@ -55,6 +53,8 @@ extern "C" {
 #include "../others/sysmon/lv_sysmon_private.h"
 #include "../others/test/lv_test_private.h"
 #include "../layouts/lv_layout_private.h"
+#include "lv_obj_render_cache_private.h"
+#include "lv_obj_style_private.h"
 
 /*********************
  *      DEFINES
@@ -94,10 +94,17 @@ typedef struct _lv_global_t {
     uint32_t style_custom_table_size;
     uint32_t style_last_custom_prop_id;
     uint8_t * style_custom_prop_flag_lookup_table;
+#if LV_OBJ_STYLE_RESOLVED_CACHE_LINES
+    lv_obj_style_resolved_cache_t style_resolved_cache;
+#endif
 
     lv_ll_t group_ll;
     lv_group_t * group_default;
 
+#if LV_USE_OBSERVER
+    lv_ll_t subject_batch_ll;   /**< Batched subjects whose observers are not notified yet*/
+#endif
+
     lv_ll_t indev_ll;
     lv_indev_t * indev_active;
     lv_obj_t * indev_obj_active;
@@ -125,6 +132,10 @@ typedef struct _lv_global_t {
 
     lv_cache_t * img_cache;
     lv_cache_t * img_header_cache;
+    lv_cache_t * img_alpha_cache;
+#if LV_USE_OBJ_RENDER_CACHE
+    lv_obj_render_cache_state_t obj_render_cache;
+#endif
 
     lv_draw_global_info_t draw_info;
     lv_ll_t draw_sw_blend_handler_ll;
@@ -199,6 +210,13 @@ typedef struct _lv_global_t {
     lv_font_fmt_rle_t font_fmt_rle;
 #endif
 
+#if LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE
+    lv_font_fmt_txt_gid_cache_entry_t font_fmt_gid_cache[LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE];
+#endif
+    lv_ll_t font_fmt_index_ll;
+    lv_cache_t * font_fmt_glyph_cache;
+    lv_font_fmt_txt_glyph_cache_stats_t font_fmt_glyph_cache_stats;
+
 #if LV_USE_SPAN != 0
     struct _snippet_stack * span_snippet_stack;
 #endif
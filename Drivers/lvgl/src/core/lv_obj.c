@@ -26,6 +26,7 @@
 #include "../tick/lv_tick.h"
 #include "../stdlib/lv_string.h"
 #include "lv_obj_draw_private.h"
+#include "lv_obj_render_cache_private.h"
 
 /*********************
  *      DEFINES
@@ -581,6 +582,10 @@ static void lv_obj_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     /*Remove the animations from this object*/
     lv_anim_delete(obj, NULL);
 
+#if LV_USE_OBJ_RENDER_CACHE
+    lv_obj_set_render_cache(obj, false);
+#endif
+
     /*Delete from the group*/
     lv_group_t * group = lv_obj_get_group(obj);
     if(group) lv_group_remove_obj(obj);
@@ -933,7 +938,7 @@ static void lv_obj_event(const lv_obj_class_t * class_p, lv_event_t * e)
         }
     }
     else if(code == LV_EVENT_CHILD_DELETED) {
-        obj->readjust_scroll_after_layout = 1;
+        lv_obj_mark_scroll_readjust(obj);
         lv_obj_mark_layout_as_dirty(obj);
     }
     else if(code == LV_EVENT_REFR_EXT_DRAW_SIZE) {
@@ -29,6 +29,7 @@ extern "C" {
 #include "lv_obj_class.h"
 #include "lv_obj_event.h"
 #include "lv_obj_property.h"
+#include "lv_obj_render_cache.h"
 #include "lv_group.h"
 
 /*********************
@@ -12,6 +12,7 @@
 #include "lv_obj_draw_private.h"
 #include "lv_obj_style_private.h"
 #include "lv_obj_private.h"
+#include "lv_obj_render_cache_private.h"
 #include "../display/lv_display.h"
 #include "../display/lv_display_private.h"
 #include "lv_refr_private.h"
@@ -32,9 +33,12 @@
  **********************/
 static int32_t calc_content_width(lv_obj_t * obj);
 static int32_t calc_content_height(lv_obj_t * obj);
+static void mark_layout_update_needed(lv_obj_t * obj);
 static void layout_update_core(lv_obj_t * obj);
 static void transform_point_array(const lv_obj_t * obj, lv_point_t * p, size_t p_count, bool inv);
 static bool is_transformed(const lv_obj_t * obj);
+static void get_invalidate_area(const lv_obj_t * obj, lv_area_t * area);
+static void invalidate_area_core(const lv_obj_t * obj, const lv_area_t * area);
 
 /**********************
  *  STATIC VARIABLES
@@ -198,7 +202,7 @@ bool lv_obj_refr_size(lv_obj_t * obj)
     /*Invalidate the new area*/
     lv_obj_invalidate(obj);
 
-    obj->readjust_scroll_after_layout = 1;
+    lv_obj_mark_scroll_readjust(obj);
 
     /*If the object was out of the parent invalidate the new scrollbar area too.
      *If it wasn't out of the parent but out now, also invalidate the scrollbars*/
@@ -282,14 +286,13 @@ bool lv_obj_is_layout_positioned(const lv_obj_t * obj)
 void lv_obj_mark_layout_as_dirty(lv_obj_t * obj)
 {
     obj->layout_inv = 1;
+    mark_layout_update_needed(obj);
+}
 
-    /*Mark the screen as dirty too to mark that there is something to do on this screen*/
-    lv_obj_t * scr = lv_obj_get_screen(obj);
-    scr->scr_layout_inv = 1;
-
-    /*Make the display refreshing*/
-    lv_display_t * disp = lv_obj_get_display(scr);
-    lv_display_send_event(disp, LV_EVENT_REFR_REQUEST, NULL);
+void lv_obj_mark_scroll_readjust(lv_obj_t * obj)
+{
+    obj->readjust_scroll_after_layout = 1;
+    mark_layout_update_needed(obj);
 }
 
 void lv_obj_update_layout(const lv_obj_t * obj)
@@ -723,7 +726,7 @@ void lv_obj_move_to(lv_obj_t * obj, int32_t x, int32_t y)
     if(diff.x == 0 && diff.y == 0) return;
 
     /*Invalidate the original area*/
-    lv_obj_invalidate(obj);
+    lv_obj_invalidate_moved(obj);
 
     /*Save the original coordinates*/
     lv_area_t ori;
@@ -752,7 +755,7 @@ void lv_obj_move_to(lv_obj_t * obj, int32_t x, int32_t y)
     if(parent) lv_obj_send_event(parent, LV_EVENT_CHILD_CHANGED, obj);
 
     /*Invalidate the new area*/
-    lv_obj_invalidate(obj);
+    lv_obj_invalidate_moved(obj);
 
     /*If the object was out of the parent invalidate the new scrollbar area too.
      *If it wasn't out of the parent but out now, also invalidate the scrollbars*/
@@ -823,46 +826,37 @@ void lv_obj_invalidate_area(const lv_obj_t * obj, const lv_area_t * area)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
-    lv_display_t * disp   = lv_obj_get_display(obj);
-    if(!lv_display_is_invalidation_enabled(disp)) return;
-
-    lv_area_t area_tmp;
-    lv_area_copy(&area_tmp, area);
-
-    if(!lv_obj_area_is_visible(obj, &area_tmp)) return;
-#if LV_DRAW_TRANSFORM_USE_MATRIX
-    /**
-     * When using the global matrix, the vertex coordinates of clip_area lose precision after transformation,
-     * which can be solved by expanding the redrawing area.
-     */
-    lv_area_increase(&area_tmp, 5, 5);
-#else
-    if(obj->spec_attr && obj->spec_attr->layer_type == LV_LAYER_TYPE_TRANSFORM) {
-        /*Make the area slightly larger to avoid rounding errors.
-         *5 is an empirical value*/
-        lv_area_increase(&area_tmp, 5, 5);
-    }
+#if LV_USE_OBJ_RENDER_CACHE
+    /*Drop the cached images even if the change is not visible now*/
+    lv_obj_render_cache_invalidate(obj);
 #endif
 
-    lv_inv_area(lv_obj_get_display(obj),  &area_tmp);
+    invalidate_area_core(obj, area);
 }
 
 void lv_obj_invalidate(const lv_obj_t * obj)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
-    /*Truncate the area to the object*/
     lv_area_t obj_coords;
-    int32_t ext_size = lv_obj_get_ext_draw_size(obj);
-    lv_area_copy(&obj_coords, &obj->coords);
-    obj_coords.x1 -= ext_size;
-    obj_coords.y1 -= ext_size;
-    obj_coords.x2 += ext_size;
-    obj_coords.y2 += ext_size;
-
+    get_invalidate_area(obj, &obj_coords);
     lv_obj_invalidate_area(obj, &obj_coords);
 }
 
+void lv_obj_invalidate_moved(const lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+#if LV_USE_OBJ_RENDER_CACHE
+    /*The content of the widget is the same so only the images of the parents change*/
+    lv_obj_render_cache_invalidate(obj->parent);
+#endif
+
+    lv_area_t obj_coords;
+    get_invalidate_area(obj, &obj_coords);
+    invalidate_area_core(obj, &obj_coords);
+}
+
 bool lv_obj_area_is_visible(const lv_obj_t * obj, lv_area_t * area)
 {
     if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return false;
@@ -1065,6 +1059,53 @@ const lv_matrix_t * lv_obj_get_transform(const lv_obj_t * obj)
  *   STATIC FUNCTIONS
  **********************/
 
+/**
+ * Get the area to invalidate to redraw a widget
+ * @param obj       pointer to a widget
+ * @param area      store the area here
+ */
+static void get_invalidate_area(const lv_obj_t * obj, lv_area_t * area)
+{
+    /*Truncate the area to the object*/
+    int32_t ext_size = lv_obj_get_ext_draw_size(obj);
+    lv_area_copy(area, &obj->coords);
+    area->x1 -= ext_size;
+    area->y1 -= ext_size;
+    area->x2 += ext_size;
+    area->y2 += ext_size;
+}
+
+/**
+ * Invalidate an area of a widget without dropping its cached rendered image
+ * @param obj       pointer to a widget
+ * @param area      the area to invalidate
+ */
+static void invalidate_area_core(const lv_obj_t * obj, const lv_area_t * area)
+{
+    lv_display_t * disp   = lv_obj_get_display(obj);
+    if(!lv_display_is_invalidation_enabled(disp)) return;
+
+    lv_area_t area_tmp;
+    lv_area_copy(&area_tmp, area);
+
+    if(!lv_obj_area_is_visible(obj, &area_tmp)) return;
+#if LV_DRAW_TRANSFORM_USE_MATRIX
+    /**
+     * When using the global matrix, the vertex coordinates of clip_area lose precision after transformation,
+     * which can be solved by expanding the redrawing area.
+     */
+    lv_area_increase(&area_tmp, 5, 5);
+#else
+    if(obj->spec_attr && obj->spec_attr->layer_type == LV_LAYER_TYPE_TRANSFORM) {
+        /*Make the area slightly larger to avoid rounding errors.
+         *5 is an empirical value*/
+        lv_area_increase(&area_tmp, 5, 5);
+    }
+#endif
+
+    lv_inv_area(lv_obj_get_display(obj),  &area_tmp);
+}
+
 static bool is_transformed(const lv_obj_t * obj)
 {
     while(obj) {
@@ -1221,14 +1262,52 @@ static int32_t calc_content_height(lv_obj_t * obj)
     return LV_MAX(self_h, child_res + space_bottom);
 }
 
+/**
+ * Mark the ancestors and the screen of a widget, so the next layout update visits the widget
+ * @param obj       the widget with `layout_inv` or `readjust_scroll_after_layout` set
+ */
+static void mark_layout_update_needed(lv_obj_t * obj)
+{
+#if LV_LAYOUT_DIRTY_SUBTREE
+    /*Mark the ancestors too, so only the branches leading to invalid layouts are visited on update*/
+    lv_obj_t * parent = obj->parent;
+    while(parent && parent->child_layout_inv == 0) {
+        parent->child_layout_inv = 1;
+        parent = parent->parent;
+    }
+#endif
+
+    /*Mark the screen as dirty too to mark that there is something to do on this screen*/
+    lv_obj_t * scr = lv_obj_get_screen(obj);
+    scr->scr_layout_inv = 1;
+
+    /*Make the display refreshing*/
+    lv_display_t * disp = lv_obj_get_display(scr);
+    lv_display_send_event(disp, LV_EVENT_REFR_REQUEST, NULL);
+}
+
 static void layout_update_core(lv_obj_t * obj)
 {
     uint32_t i;
     uint32_t child_cnt = lv_obj_get_child_count(obj);
+#if LV_LAYOUT_DIRTY_SUBTREE
+    /*Descend only into the children which are invalid or have invalid descendants.
+     *The flag is cleared first, so the invalidations while updating the children mark it again.*/
+    if(obj->child_layout_inv) {
+        obj->child_layout_inv = 0;
+        for(i = 0; i < child_cnt; i++) {
+            lv_obj_t * child = obj->spec_attr->children[i];
+            if(child->layout_inv || child->child_layout_inv || child->readjust_scroll_after_layout) {
+                layout_update_core(child);
+            }
+        }
+    }
+#else
     for(i = 0; i < child_cnt; i++) {
         lv_obj_t * child = obj->spec_attr->children[i];
         layout_update_core(child);
     }
+#endif
 
     if(obj->layout_inv) {
         obj->layout_inv = 0;
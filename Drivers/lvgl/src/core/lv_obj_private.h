@@ -60,6 +60,9 @@ struct _lv_obj_t {
 #if LV_OBJ_STYLE_CACHE
     uint32_t style_main_prop_is_set;
     uint32_t style_other_prop_is_set;
+#endif
+#if LV_OBJ_STYLE_RESOLVED_CACHE_LINES
+    uint32_t style_resolved_id;     /**< Changed when the styles change to drop the resolved values, 0: not cached*/
 #endif
     void * user_data;
 #if LV_USE_OBJ_ID
@@ -76,12 +79,32 @@ struct _lv_obj_t {
     uint16_t h_layout   : 1;
     uint16_t w_layout   : 1;
     uint16_t is_deleting : 1;
+#if LV_LAYOUT_DIRTY_SUBTREE
+    uint16_t child_layout_inv : 1;  /**< A descendant's layout is invalid*/
+#endif
+#if LV_USE_OBJ_RENDER_CACHE
+    uint16_t render_cache : 1;
+#endif
 };
 
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 
+/**
+ * Invalidate a widget before and after moving it without changing its content.
+ * Unlike `lv_obj_invalidate()` it keeps the cached rendered image of the widget.
+ * @param obj       pointer to an object
+ */
+void lv_obj_invalidate_moved(const lv_obj_t * obj);
+
+/**
+ * Readjust the scroll position of a widget on the next layout update,
+ * e.g. when its size or children have changed.
+ * @param obj       pointer to an object
+ */
+void lv_obj_mark_scroll_readjust(lv_obj_t * obj);
+
 /**********************
  *      MACROS
  **********************/
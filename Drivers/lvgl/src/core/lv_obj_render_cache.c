@@ -0,0 +1,384 @@
+/**
+ * @file lv_obj_render_cache.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_obj_render_cache_private.h"
+#if LV_USE_OBJ_RENDER_CACHE
+
+#if LV_USE_SNAPSHOT == 0
+    #error "LV_USE_OBJ_RENDER_CACHE requires LV_USE_SNAPSHOT"
+#endif
+
+#include "lv_obj_private.h"
+#include "lv_obj_draw_private.h"
+#include "lv_obj_event_private.h"
+#include "lv_global.h"
+#include "../display/lv_display.h"
+#include "../draw/lv_draw_image.h"
+#include "../misc/cache/lv_cache.h"
+#include "../misc/cache/lv_cache_private.h"
+#include "../others/snapshot/lv_snapshot.h"
+#include "../stdlib/lv_string.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define MY_CLASS (&lv_obj_class)
+#define CACHE_NAME  "OBJ_RENDER"
+
+#define state_p (&LV_GLOBAL_DEFAULT()->obj_render_cache)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    lv_cache_slot_size_t slot;
+    const lv_obj_t * obj;
+    lv_draw_buf_t * draw_buf;
+    uint8_t pinned : 1;     /**< Already in `pinned_ll` in this refresh*/
+    uint8_t dropped : 1;    /**< Dropped on purpose, not evicted*/
+} render_cache_data_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static lv_cache_compare_res_t render_cache_compare_cb(const render_cache_data_t * lhs,
+                                                      const render_cache_data_t * rhs);
+static void render_cache_free_cb(render_cache_data_t * data, void * user_data);
+static void drop_obj(const lv_obj_t * obj, bool count);
+static lv_cache_entry_t * render_to_cache(lv_obj_t * obj, int32_t w, int32_t h);
+static void pin_entry(lv_cache_entry_t * entry);
+static void convert_argb8888_to_rgb565a8(const lv_draw_buf_t * src, lv_draw_buf_t * dest);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_obj_render_cache_init(void)
+{
+    lv_obj_render_cache_state_t * state = state_p;
+    lv_memzero(state, sizeof(lv_obj_render_cache_state_t));
+
+    state->cache = lv_cache_create(&lv_cache_class_lru_rb_size,
+    sizeof(render_cache_data_t), LV_OBJ_RENDER_CACHE_SIZE, (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t) render_cache_compare_cb,
+        .create_cb = NULL,
+        .free_cb = (lv_cache_free_cb_t) render_cache_free_cb,
+    });
+    lv_cache_set_name(state->cache, CACHE_NAME);
+
+    lv_ll_init(&state->pinned_ll, sizeof(lv_cache_entry_t *));
+    lv_ll_init(&state->bypass_ll, sizeof(lv_obj_t *));
+}
+
+void lv_obj_render_cache_deinit(void)
+{
+    lv_obj_render_cache_state_t * state = state_p;
+    if(state->cache == NULL) return;
+
+    lv_obj_render_cache_release_pinned();
+    lv_cache_destroy(state->cache, NULL);
+    state->cache = NULL;
+}
+
+void lv_obj_set_render_cache(lv_obj_t * obj, bool en)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    if(obj->render_cache == en) return;
+
+    lv_obj_render_cache_state_t * state = state_p;
+    if(en) {
+        obj->render_cache = 1;
+        state->obj_cnt++;
+    }
+    else {
+        drop_obj(obj, false);
+        obj->render_cache = 0;
+        state->obj_cnt--;
+    }
+}
+
+bool lv_obj_get_render_cache(const lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    return obj->render_cache;
+}
+
+void lv_obj_render_cache_get_stats(lv_obj_render_cache_stats_t * stats)
+{
+    LV_ASSERT_NULL(stats);
+
+    lv_obj_render_cache_state_t * state = state_p;
+    *stats = state->stats;
+    stats->size = lv_cache_get_size(state->cache, NULL);
+    stats->max_size = lv_cache_get_max_size(state->cache, NULL);
+}
+
+void lv_obj_render_cache_reset_stats(void)
+{
+    lv_memzero(&state_p->stats, sizeof(lv_obj_render_cache_stats_t));
+}
+
+void lv_obj_render_cache_resize(uint32_t new_size)
+{
+    lv_obj_render_cache_state_t * state = state_p;
+    lv_cache_set_max_size(state->cache, new_size, NULL);
+    lv_cache_reserve(state->cache, new_size, NULL);
+}
+
+lv_result_t lv_obj_render_cache_draw(lv_layer_t * layer, lv_obj_t * obj)
+{
+    lv_obj_render_cache_state_t * state = state_p;
+
+    /*Blending the image with opacity or recolor would look different than
+     *blending each part of the widget one by one, so draw it as usual*/
+    if(layer->opa < LV_OPA_MAX || layer->recolor.alpha > LV_OPA_MIN) return LV_RESULT_INVALID;
+
+    int32_t ext_size = lv_obj_get_ext_draw_size(obj);
+    lv_area_t image_area = obj->coords;
+    lv_area_increase(&image_area, ext_size, ext_size);
+    int32_t w = lv_area_get_width(&image_area);
+    int32_t h = lv_area_get_height(&image_area);
+    if(w <= 0 || h <= 0) return LV_RESULT_INVALID;
+
+    render_cache_data_t search_key;
+    lv_memzero(&search_key, sizeof(search_key));
+    search_key.obj = obj;
+
+    lv_cache_entry_t * entry = lv_cache_acquire(state->cache, &search_key, NULL);
+    if(entry) {
+        /*The content is the same after moving the widget but not after resizing it*/
+        render_cache_data_t * data = lv_cache_entry_get_data(entry);
+        if(data->draw_buf->header.w != w || data->draw_buf->header.h != h) {
+            data->dropped = 1;
+            lv_cache_release(state->cache, entry, NULL);
+            lv_cache_drop(state->cache, &search_key, NULL);
+            entry = NULL;
+        }
+        else {
+            state->stats.hit_cnt++;
+        }
+    }
+
+    if(entry == NULL) {
+        /*Don't try again in each band if it failed once in this refresh*/
+        lv_obj_t ** obj_p;
+        LV_LL_READ(&state->bypass_ll, obj_p) {
+            if(*obj_p == obj) return LV_RESULT_INVALID;
+        }
+
+        entry = render_to_cache(obj, w, h);
+        if(entry == NULL) {
+            state->stats.bypass_cnt++;
+            obj_p = lv_ll_ins_tail(&state->bypass_ll);
+            LV_ASSERT_MALLOC(obj_p);
+            if(obj_p) *obj_p = obj;
+            return LV_RESULT_INVALID;
+        }
+        state->stats.miss_cnt++;
+    }
+
+    render_cache_data_t * data = lv_cache_entry_get_data(entry);
+
+    lv_draw_image_dsc_t draw_dsc;
+    lv_draw_image_dsc_init(&draw_dsc);
+    draw_dsc.base.obj = obj;
+    draw_dsc.src = data->draw_buf;
+    lv_draw_image(layer, &draw_dsc, &image_area);
+
+    /*The draw task uses the buffer later so keep it until the refresh is ready*/
+    pin_entry(entry);
+
+    return LV_RESULT_OK;
+}
+
+void lv_obj_render_cache_invalidate(const lv_obj_t * obj)
+{
+    if(state_p->obj_cnt == 0) return;
+
+    while(obj) {
+        if(obj->render_cache) drop_obj(obj, true);
+        obj = obj->parent;
+    }
+}
+
+void lv_obj_render_cache_release_pinned(void)
+{
+    lv_obj_render_cache_state_t * state = state_p;
+
+    lv_cache_entry_t ** entry_p;
+    LV_LL_READ(&state->pinned_ll, entry_p) {
+        render_cache_data_t * data = lv_cache_entry_get_data(*entry_p);
+        data->pinned = 0;
+        lv_cache_release(state->cache, *entry_p, NULL);
+    }
+
+    lv_ll_clear(&state->pinned_ll);
+    lv_ll_clear(&state->bypass_ll);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static lv_cache_compare_res_t render_cache_compare_cb(const render_cache_data_t * lhs,
+                                                      const render_cache_data_t * rhs)
+{
+    if(lhs->obj == rhs->obj) return 0;
+    return lhs->obj > rhs->obj ? 1 : -1;
+}
+
+static void render_cache_free_cb(render_cache_data_t * data, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    if(!data->dropped) state_p->stats.evict_cnt++;
+    if(data->draw_buf) lv_draw_buf_destroy(data->draw_buf);
+}
+
+static void drop_obj(const lv_obj_t * obj, bool count)
+{
+    lv_obj_render_cache_state_t * state = state_p;
+
+    render_cache_data_t search_key;
+    lv_memzero(&search_key, sizeof(search_key));
+    search_key.obj = obj;
+
+    lv_cache_entry_t * entry = lv_cache_acquire(state->cache, &search_key, NULL);
+    if(entry == NULL) return;
+
+    render_cache_data_t * data = lv_cache_entry_get_data(entry);
+    data->dropped = 1;
+    if(count) state->stats.invalidate_cnt++;
+
+    lv_cache_release(state->cache, entry, NULL);
+    lv_cache_drop(state->cache, &search_key, NULL);
+}
+
+static lv_cache_entry_t * render_to_cache(lv_obj_t * obj, int32_t w, int32_t h)
+{
+    lv_obj_render_cache_state_t * state = state_p;
+
+    /*Use the display's format if the widget covers its whole image, else keep an alpha channel too*/
+    lv_color_format_t disp_cf = lv_display_get_color_format(lv_obj_get_display(obj));
+    lv_color_format_t cf = LV_COLOR_FORMAT_ARGB8888;
+    if(lv_obj_get_ext_draw_size(obj) == 0) {
+        lv_cover_check_info_t info;
+        info.res = LV_COVER_RES_COVER;
+        info.area = &obj->coords;
+        lv_obj_send_event(obj, LV_EVENT_COVER_CHECK, &info);
+        if(info.res == LV_COVER_RES_COVER &&
+           (disp_cf == LV_COLOR_FORMAT_RGB565 || disp_cf == LV_COLOR_FORMAT_RGB888 ||
+            disp_cf == LV_COLOR_FORMAT_XRGB8888)) {
+            cf = disp_cf;
+        }
+    }
+
+    /*RGB565A8 needs only 3 bytes per pixel instead of 4*/
+    if(cf == LV_COLOR_FORMAT_ARGB8888 && disp_cf == LV_COLOR_FORMAT_RGB565) cf = LV_COLOR_FORMAT_RGB565A8;
+
+    uint32_t data_size = lv_draw_buf_width_to_stride(w, cf) * h;
+    if(cf == LV_COLOR_FORMAT_RGB565A8) data_size += data_size / 2;
+    if(data_size > lv_cache_get_max_size(state->cache, NULL)) return NULL;
+
+    render_cache_data_t search_key;
+    lv_memzero(&search_key, sizeof(search_key));
+    search_key.slot.size = data_size;
+    search_key.obj = obj;
+
+    /*Evicts the least recently used images if required.
+     *Fails if the others are used in this refresh and can't be dropped.*/
+    lv_cache_entry_t * entry = lv_cache_add(state->cache, &search_key, NULL);
+    if(entry == NULL) return NULL;
+
+    render_cache_data_t * data = lv_cache_entry_get_data(entry);
+    lv_draw_buf_t * draw_buf = lv_draw_buf_create(w, h, cf, LV_STRIDE_AUTO);
+    lv_result_t res = LV_RESULT_INVALID;
+    if(draw_buf) {
+        if(cf == LV_COLOR_FORMAT_RGB565A8) {
+            lv_draw_buf_t * argb_buf = lv_draw_buf_create(w, h, LV_COLOR_FORMAT_ARGB8888, LV_STRIDE_AUTO);
+            if(argb_buf) {
+                lv_draw_buf_clear(argb_buf, NULL);
+                res = lv_snapshot_take_to_draw_buf(obj, LV_COLOR_FORMAT_ARGB8888, argb_buf);
+                if(res == LV_RESULT_OK) convert_argb8888_to_rgb565a8(argb_buf, draw_buf);
+                lv_draw_buf_destroy(argb_buf);
+            }
+        }
+        else {
+            if(cf == LV_COLOR_FORMAT_ARGB8888) lv_draw_buf_clear(draw_buf, NULL);
+            res = lv_snapshot_take_to_draw_buf(obj, cf, draw_buf);
+        }
+    }
+
+    if(res != LV_RESULT_OK) {
+        if(draw_buf) lv_draw_buf_destroy(draw_buf);
+        data->draw_buf = NULL;
+        data->dropped = 1;
+        lv_cache_release(state->cache, entry, NULL);
+        lv_cache_drop(state->cache, &search_key, NULL);
+        return NULL;
+    }
+
+    data->draw_buf = draw_buf;
+    return entry;
+}
+
+static void pin_entry(lv_cache_entry_t * entry)
+{
+    lv_obj_render_cache_state_t * state = state_p;
+
+    /*Keep only one reference per refresh*/
+    render_cache_data_t * data = lv_cache_entry_get_data(entry);
+    if(data->pinned) {
+        lv_cache_release(state->cache, entry, NULL);
+        return;
+    }
+
+    lv_cache_entry_t ** entry_p = lv_ll_ins_tail(&state->pinned_ll);
+    LV_ASSERT_MALLOC(entry_p);
+    if(entry_p == NULL) return;
+
+    *entry_p = entry;
+    data->pinned = 1;
+}
+
+static void convert_argb8888_to_rgb565a8(const lv_draw_buf_t * src, lv_draw_buf_t * dest)
+{
+    int32_t w = dest->header.w;
+    int32_t h = dest->header.h;
+    uint32_t src_stride = src->header.stride;
+    uint32_t dest_stride = dest->header.stride;
+
+    /*The alpha map follows the color map with half stride*/
+    uint8_t * dest_a = dest->data + dest_stride * h;
+    uint32_t dest_a_stride = dest_stride / 2;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        const lv_color32_t * src_px = (const lv_color32_t *)(src->data + src_stride * y);
+        uint16_t * dest_px = (uint16_t *)(dest->data + dest_stride * y);
+        lv_opa_t * dest_opa = dest_a + dest_a_stride * y;
+        int32_t x;
+        for(x = 0; x < w; x++) {
+            dest_px[x] = ((src_px[x].red & 0xF8) << 8) | ((src_px[x].green & 0xFC) << 3) | (src_px[x].blue >> 3);
+            dest_opa[x] = src_px[x].alpha;
+        }
+    }
+}
+
+#endif /*LV_USE_OBJ_RENDER_CACHE*/
@@ -0,0 +1,89 @@
+/**
+ * @file lv_obj_render_cache.h
+ *
+ */
+
+#ifndef LV_OBJ_RENDER_CACHE_H
+#define LV_OBJ_RENDER_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+#include "../misc/lv_types.h"
+
+#if LV_USE_OBJ_RENDER_CACHE
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    uint32_t hit_cnt;           /**< Number of times a cached image was drawn instead of the widget*/
+    uint32_t miss_cnt;          /**< Number of times the widget had to be rendered into the cache*/
+    uint32_t invalidate_cnt;    /**< Number of cached images dropped because the widget or a child changed*/
+    uint32_t evict_cnt;         /**< Number of cached images dropped to stay in `LV_OBJ_RENDER_CACHE_SIZE`*/
+    uint32_t bypass_cnt;        /**< Number of times the widget was drawn directly as it didn't fit into the cache*/
+    uint32_t size;              /**< Memory used by the cached images [bytes]*/
+    uint32_t max_size;          /**< Size of the cache [bytes]*/
+} lv_obj_render_cache_stats_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Render a widget and its children only once into an image and draw this image
+ * until the widget or any of its children is invalidated.
+ * Useful for complex but rarely changing parts of the UI, e.g. a dial face with many labels.
+ * @param obj       pointer to an object
+ * @param en        true: enable caching; false: disable caching and drop the cached image
+ * @note            The widget is drawn as usual while it or a parent has `opa` or `recolor`.
+ *                  Changes on the parents which affect how the widget looks (e.g. inherited
+ *                  styles) require `lv_obj_invalidate(obj)`.
+ */
+void lv_obj_set_render_cache(lv_obj_t * obj, bool en);
+
+/**
+ * Tell whether the rendered image of a widget is cached.
+ * @param obj       pointer to an object
+ * @return          true: caching is enabled for the widget
+ */
+bool lv_obj_get_render_cache(const lv_obj_t * obj);
+
+/**
+ * Get the statistics of the widget render cache.
+ * @param stats     store the result here
+ */
+void lv_obj_render_cache_get_stats(lv_obj_render_cache_stats_t * stats);
+
+/**
+ * Reset the counters of the widget render cache.
+ */
+void lv_obj_render_cache_reset_stats(void);
+
+/**
+ * Change the size of the widget render cache.
+ * @param new_size  the new size in bytes
+ */
+void lv_obj_render_cache_resize(uint32_t new_size);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_OBJ_RENDER_CACHE*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_OBJ_RENDER_CACHE_H*/
@@ -0,0 +1,84 @@
+/**
+ * @file lv_obj_render_cache_private.h
+ *
+ */
+
+#ifndef LV_OBJ_RENDER_CACHE_PRIVATE_H
+#define LV_OBJ_RENDER_CACHE_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_obj_render_cache.h"
+
+#if LV_USE_OBJ_RENDER_CACHE
+
+#include "../misc/lv_ll.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    lv_cache_t * cache;
+    lv_ll_t pinned_ll;          /**< Cache entries used by the draw tasks of the current refresh*/
+    lv_ll_t bypass_ll;          /**< Widgets which couldn't be cached in the current refresh*/
+    uint32_t obj_cnt;           /**< Number of widgets with enabled caching*/
+    lv_obj_render_cache_stats_t stats;
+} lv_obj_render_cache_state_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Initialize the widget render cache
+ */
+void lv_obj_render_cache_init(void);
+
+/**
+ * Drop all cached images and free the widget render cache
+ */
+void lv_obj_render_cache_deinit(void);
+
+/**
+ * Draw a widget and its children from the cache. Render them into the cache first if required.
+ * @param layer     the layer to draw to
+ * @param obj       pointer to an object with enabled caching
+ * @return          LV_RESULT_OK: the widget is drawn;
+ *                  LV_RESULT_INVALID: the widget can't be cached, draw it as usual
+ */
+lv_result_t lv_obj_render_cache_draw(lv_layer_t * layer, lv_obj_t * obj);
+
+/**
+ * Drop the cached image of the object and all of its parents as something changed in them.
+ * @param obj       pointer to an object
+ */
+void lv_obj_render_cache_invalidate(const lv_obj_t * obj);
+
+/**
+ * Release the cached images used in the last refresh and allow caching the widgets
+ * which couldn't be cached in it. Call it when all draw tasks are ready.
+ */
+void lv_obj_render_cache_release_pinned(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_OBJ_RENDER_CACHE*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_OBJ_RENDER_CACHE_PRIVATE_H*/
@@ -23,6 +23,7 @@
 #define style_trans_ll_p &(LV_GLOBAL_DEFAULT()->style_trans_ll)
 #define _style_custom_prop_flag_lookup_table LV_GLOBAL_DEFAULT()->style_custom_prop_flag_lookup_table
 #define STYLE_PROP_SHIFTED(prop) ((uint32_t)1 << ((prop) >> 3))
+#define resolved_cache LV_GLOBAL_DEFAULT()->style_resolved_cache
 
 /**********************
  *      TYPEDEFS
@@ -57,6 +58,7 @@ static lv_style_res_t get_prop_core(const lv_obj_t * obj, lv_style_selector_t se
                                     lv_style_value_t * v);
 static void report_style_change_core(void * style, lv_obj_t * obj);
 static void refresh_children_style(lv_obj_t * obj);
+static void invalidate_part(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop);
 static bool trans_delete(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, trans_t * tr_limit);
 static void trans_anim_cb(void * _tr, int32_t v);
 static void trans_anim_start_cb(lv_anim_t * a);
@@ -68,11 +70,55 @@ static void fade_in_anim_completed(lv_anim_t * a);
 static bool style_has_flag(const lv_style_t * style, uint32_t flag);
 static lv_style_res_t get_selector_style_prop(const lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop,
                                               lv_style_value_t * value_act);
+#if LV_OBJ_STYLE_RESOLVED_CACHE_LINES
+    static lv_obj_style_resolved_t * resolved_get_line(const lv_obj_t * obj, lv_part_t part);
+    static void resolved_invalidate(lv_obj_t * obj);
+    static void resolved_invalidate_all(void);
+#endif
 
 /**********************
  *  STATIC VARIABLES
  **********************/
 
+#if LV_OBJ_STYLE_RESOLVED_CACHE_LINES
+/*The slot + 1 of the cached properties in `lv_obj_style_resolved_t`. Only not inheritable properties can be cached
+ *as the changes of the parents don't invalidate the children.*/
+static const uint8_t resolved_slots[LV_STYLE_NUM_BUILT_IN_PROPS] = {
+    [LV_STYLE_RADIUS] = 1,
+    [LV_STYLE_PAD_TOP] = 2,
+    [LV_STYLE_PAD_BOTTOM] = 3,
+    [LV_STYLE_PAD_LEFT] = 4,
+    [LV_STYLE_PAD_RIGHT] = 5,
+    [LV_STYLE_PAD_ROW] = 6,
+    [LV_STYLE_PAD_COLUMN] = 7,
+    [LV_STYLE_MARGIN_TOP] = 8,
+    [LV_STYLE_MARGIN_BOTTOM] = 9,
+    [LV_STYLE_MARGIN_LEFT] = 10,
+    [LV_STYLE_MARGIN_RIGHT] = 11,
+    [LV_STYLE_BG_COLOR] = 12,
+    [LV_STYLE_BG_OPA] = 13,
+    [LV_STYLE_BG_GRAD_DIR] = 14,
+    [LV_STYLE_BG_GRAD] = 15,
+    [LV_STYLE_BG_IMAGE_SRC] = 16,
+    [LV_STYLE_CLIP_CORNER] = 17,
+    [LV_STYLE_BORDER_WIDTH] = 18,
+    [LV_STYLE_BORDER_COLOR] = 19,
+    [LV_STYLE_BORDER_OPA] = 20,
+    [LV_STYLE_BORDER_SIDE] = 21,
+    [LV_STYLE_BORDER_POST] = 22,
+    [LV_STYLE_OUTLINE_WIDTH] = 23,
+    [LV_STYLE_OUTLINE_OPA] = 24,
+    [LV_STYLE_SHADOW_WIDTH] = 25,
+    [LV_STYLE_SHADOW_OPA] = 26,
+    [LV_STYLE_OPA] = 27,
+    [LV_STYLE_OPA_LAYERED] = 28,
+    [LV_STYLE_BLEND_MODE] = 29,
+    [LV_STYLE_TRANSFORM_WIDTH] = 30,
+    [LV_STYLE_TRANSFORM_HEIGHT] = 31,
+    [LV_STYLE_RECOLOR_OPA] = 32,
+};
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -260,6 +306,11 @@ void lv_obj_remove_style_all(lv_obj_t * obj)
 
 void lv_obj_report_style_change(lv_style_t * style)
 {
+#if LV_OBJ_STYLE_RESOLVED_CACHE_LINES
+    /*The style can be used by any widget*/
+    resolved_invalidate_all();
+#endif
+
     if(!style_refr) return;
     lv_display_t * d = lv_display_get_next(NULL);
 
@@ -276,14 +327,24 @@ void lv_obj_refresh_style(lv_obj_t * obj, lv_style_selector_t selector, lv_style
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+#if LV_OBJ_STYLE_RESOLVED_CACHE_LINES
+    /*Drop the resolved values even if refreshing is disabled as the values are changed already*/
+    resolved_invalidate(obj);
+#endif
+
     if(!style_refr) return;
 
     LV_PROFILER_STYLE_BEGIN;
 
-    lv_obj_invalidate(obj);
-
     lv_part_t part = lv_obj_style_get_selector_part(selector);
 
+    /*The layout update invalidates the widget if it's really moved and keeps its cached image*/
+    bool is_move_only = obj->parent && part == LV_PART_MAIN &&
+                        (prop == LV_STYLE_X || prop == LV_STYLE_Y || prop == LV_STYLE_ALIGN ||
+                         prop == LV_STYLE_TRANSLATE_X || prop == LV_STYLE_TRANSLATE_Y);
+
+    if(!is_move_only) invalidate_part(obj, part, prop);
+
     bool is_layout_refr = lv_style_prop_has_flag(prop, LV_STYLE_PROP_FLAG_LAYOUT_UPDATE);
     bool is_ext_draw = lv_style_prop_has_flag(prop, LV_STYLE_PROP_FLAG_EXT_DRAW_UPDATE);
     bool is_inheritable = lv_style_prop_has_flag(prop, LV_STYLE_PROP_FLAG_INHERITABLE);
@@ -311,7 +372,7 @@ void lv_obj_refresh_style(lv_obj_t * obj, lv_style_selector_t selector, lv_style
     if(prop == LV_STYLE_PROP_ANY || is_ext_draw) {
         lv_obj_refresh_ext_draw_size(obj);
     }
-    lv_obj_invalidate(obj);
+    if(!is_move_only) invalidate_part(obj, part, prop);
 
     if(prop == LV_STYLE_PROP_ANY || (is_inheritable && (is_ext_draw || is_layout_refr))) {
         if(part != LV_PART_SCROLLBAR) {
@@ -356,20 +417,42 @@ bool lv_obj_style_get_disabled(lv_obj_t * obj, const lv_style_t * style, lv_styl
 void lv_obj_enable_style_refresh(bool en)
 {
     style_refr = en;
+#if LV_OBJ_STYLE_RESOLVED_CACHE_LINES
+    resolved_invalidate_all();
+#endif
 }
 
 lv_style_value_t lv_obj_get_style_prop(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop)
 {
     LV_ASSERT_NULL(obj)
 
+#if LV_OBJ_STYLE_RESOLVED_CACHE_LINES
+    /*Skip the cache while the transitions are ignored to get the values of a state*/
+    lv_obj_style_resolved_t * line = NULL;
+    uint32_t slot = 0;
+    if(prop < LV_STYLE_NUM_BUILT_IN_PROPS && resolved_slots[prop] != 0 &&
+       obj->style_resolved_id != 0 && !obj->skip_trans) {
+        slot = resolved_slots[prop] - 1;
+        line = resolved_get_line(obj, part);
+        if(line->valid & ((uint32_t)1 << slot)) return line->values[slot];
+    }
+#endif
+
     lv_style_selector_t selector = part | obj->state;
     lv_style_value_t value_act = { .ptr = NULL };
     lv_style_res_t found;
 
     found = get_selector_style_prop(obj, selector, prop, &value_act);
-    if(found == LV_STYLE_RES_FOUND) return value_act;
+    if(found != LV_STYLE_RES_FOUND) value_act = lv_style_prop_get_default(prop);
 
-    return lv_style_prop_get_default(prop);
+#if LV_OBJ_STYLE_RESOLVED_CACHE_LINES
+    if(line) {
+        line->values[slot] = value_act;
+        line->valid |= (uint32_t)1 << slot;
+    }
+#endif
+
+    return value_act;
 }
 
 bool lv_obj_has_style_prop(const lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop)
@@ -885,6 +968,29 @@ static void refresh_children_style(lv_obj_t * obj)
     }
 }
 
+/**
+ * Invalidate the area affected by a style change of a part
+ * @param obj       pointer to an object
+ * @param part      the part whose style has changed
+ * @param prop      the changed property or `LV_STYLE_PROP_ANY`
+ */
+static void invalidate_part(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop)
+{
+    /*E.g. the fade of the scrollbars after scrolling needs to redraw only the scrollbars.
+     *Other properties might change the scrollbar areas too, so the old areas can't be found.*/
+    if(part == LV_PART_SCROLLBAR &&
+       (prop == LV_STYLE_OPA || prop == LV_STYLE_BG_OPA || prop == LV_STYLE_BG_COLOR)) {
+        lv_area_t hor_area;
+        lv_area_t ver_area;
+        lv_obj_get_scrollbar_area(obj, &hor_area, &ver_area);
+        lv_obj_invalidate_area(obj, &hor_area);
+        lv_obj_invalidate_area(obj, &ver_area);
+        return;
+    }
+
+    lv_obj_invalidate(obj);
+}
+
 /**
  * Remove the transition from object's part's property.
  * - Remove the transition from `lv_obj_style_trans_ll` and free it
@@ -915,6 +1021,9 @@ static bool trans_delete(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, t
                     lv_style_remove_prop((lv_style_t *)obj->styles[i].style, tr->prop);
                 }
             }
+#if LV_OBJ_STYLE_RESOLVED_CACHE_LINES
+            resolved_invalidate(obj);
+#endif
 
             /*Free the transition descriptor too*/
             lv_anim_delete(tr, NULL);
@@ -1043,6 +1152,9 @@ static void trans_anim_completed_cb(lv_anim_t * a)
 
                 lv_obj_style_t * obj_style = &obj->styles[i];
                 lv_style_remove_prop((lv_style_t *)obj_style->style, prop);
+#if LV_OBJ_STYLE_RESOLVED_CACHE_LINES
+                resolved_invalidate(obj);
+#endif
 
                 if(lv_style_is_empty(obj->styles[i].style)) {
                     lv_obj_remove_style(obj, (lv_style_t *)obj_style->style, obj_style->selector);
@@ -1072,6 +1184,10 @@ static lv_layer_type_t calculate_layer_type(lv_obj_t * obj)
 
 static void full_cache_refresh(lv_obj_t * obj, lv_part_t part)
 {
+#if LV_OBJ_STYLE_RESOLVED_CACHE_LINES
+    resolved_invalidate(obj);
+#endif
+
 #if LV_OBJ_STYLE_CACHE
     uint32_t i;
     if(part == LV_PART_MAIN || part == LV_PART_ANY) {
@@ -1227,3 +1343,56 @@ static lv_style_res_t get_selector_style_prop(const lv_obj_t * obj, lv_style_sel
 
     return LV_STYLE_RES_NOT_FOUND;
 }
+
+#if LV_OBJ_STYLE_RESOLVED_CACHE_LINES
+
+/**
+ * Get the cache line of a part of a widget in its current state.
+ * The lines are in sets of 2 and the most recently started line is the first in its set.
+ * If neither line of the set matches, the older line is dropped and the other is started again.
+ */
+static lv_obj_style_resolved_t * resolved_get_line(const lv_obj_t * obj, lv_part_t part)
+{
+    uint32_t hash = (uint32_t)((lv_uintptr_t)obj >> 3) ^ (part >> 16);
+    hash = (hash * 2654435761U) >> 16;
+    lv_obj_style_resolved_t * line = &resolved_cache.lines[(hash & (LV_OBJ_STYLE_RESOLVED_CACHE_LINES / 2 - 1)) * 2];
+
+    uint32_t i;
+    for(i = 0; i < 2; i++) {
+        if(line[i].obj == obj && line[i].id == obj->style_resolved_id && line[i].part == part &&
+           line[i].state == obj->state) {
+            return &line[i];
+        }
+    }
+
+    line[1] = line[0];
+    line->obj = obj;
+    line->id = obj->style_resolved_id;
+    line->part = part;
+    line->state = obj->state;
+    line->valid = 0;
+
+    return line;
+}
+
+/**
+ * Give a new ID to a widget, so its cache lines won't match anymore
+ */
+static void resolved_invalidate(lv_obj_t * obj)
+{
+    resolved_cache.last_id++;
+    if(resolved_cache.last_id == 0) {
+        /*Overflow, drop the lines as their IDs might be given again*/
+        resolved_invalidate_all();
+        resolved_cache.last_id = 1;
+    }
+
+    obj->style_resolved_id = resolved_cache.last_id;
+}
+
+static void resolved_invalidate_all(void)
+{
+    lv_memzero(resolved_cache.lines, sizeof(resolved_cache.lines));
+}
+
+#endif /*LV_OBJ_STYLE_RESOLVED_CACHE_LINES*/
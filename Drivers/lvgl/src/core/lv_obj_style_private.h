@@ -32,6 +32,23 @@ struct _lv_obj_style_t {
     uint32_t is_disabled : 1;
 };
 
+#if LV_OBJ_STYLE_RESOLVED_CACHE_LINES
+/** The resolved values of the frequently used properties of a part of a widget in a state*/
+typedef struct {
+    const lv_obj_t * obj;
+    uint32_t id;                /**< `style_resolved_id` of `obj` when the line was started*/
+    lv_part_t part;
+    lv_state_t state;
+    uint32_t valid;             /**< Bit `n` is set if `values[n]` is already resolved*/
+    lv_style_value_t values[32];
+} lv_obj_style_resolved_t;
+
+typedef struct {
+    lv_obj_style_resolved_t lines[LV_OBJ_STYLE_RESOLVED_CACHE_LINES];
+    uint32_t last_id;           /**< The last `style_resolved_id` given to a widget*/
+} lv_obj_style_resolved_cache_t;
+#endif
+
 struct _lv_obj_style_transition_dsc_t {
     uint16_t time;
     uint16_t delay;
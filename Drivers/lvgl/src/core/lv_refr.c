@@ -12,9 +12,11 @@
 #include "../draw/sw/lv_draw_sw_mask_private.h"
 #include "../draw/lv_draw_mask_private.h"
 #include "lv_obj_private.h"
+#include "lv_obj_render_cache_private.h"
 #include "lv_obj_event_private.h"
 #include "../display/lv_display.h"
 #include "../display/lv_display_private.h"
+#include "../others/observer/lv_observer.h"
 #include "../tick/lv_tick.h"
 #include "../misc/lv_timer_private.h"
 #include "../misc/lv_math.h"
@@ -32,9 +34,25 @@
 /*Display being refreshed*/
 #define disp_refr LV_GLOBAL_DEFAULT()->disp_refresh
 
+/*Max number of sub areas to track while checking if an area is hidden*/
+#define OCCLUSION_PIECE_MAX 8
+
 /**********************
  *      TYPEDEFS
  **********************/
+#if LV_USE_REFR_OCCLUSION
+typedef struct {
+    lv_area_t area;         /**< The area fully covered by `obj` in the current band*/
+    const lv_obj_t * obj;
+    int32_t depth;          /**< Number of ancestors of `obj`*/
+} refr_occluder_t;
+
+typedef struct {
+    lv_layer_t * layer;     /**< The layer for which the occluders were collected*/
+    uint32_t cnt;
+    refr_occluder_t occluders[LV_REFR_OCCLUSION_MAX];
+} refr_occlusion_t;
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
@@ -52,6 +70,17 @@ static void wait_for_flushing(lv_display_t * disp);
 static lv_result_t layer_get_area(lv_layer_t * layer, lv_obj_t * obj, lv_layer_type_t layer_type,
                                   lv_area_t * layer_area_out, lv_area_t * obj_draw_size_out);
 static bool alpha_test_area_on_obj(lv_obj_t * obj, const lv_area_t * area);
+static void refr_obj_redraw(lv_layer_t * layer, lv_obj_t * obj);
+#if LV_USE_REFR_TILE_MAP
+    static bool tile_map_invalidate(lv_display_t * disp, const lv_area_t * area_p);
+    static void refr_tile_map_to_areas(void);
+#endif
+#if LV_USE_REFR_OCCLUSION
+    static void occlusion_collect_all(lv_layer_t * layer);
+    static void occlusion_collect(lv_obj_t * obj, const lv_area_t * clip, int32_t depth);
+    static bool occlusion_obj_is_hidden(lv_layer_t * layer, lv_obj_t * obj);
+    static bool occlusion_area_is_hidden(const lv_area_t * area, const lv_obj_t * obj, bool main_only);
+#endif
 #if LV_DRAW_TRANSFORM_USE_MATRIX
     static bool refr_check_obj_clip_overflow(lv_layer_t * layer, lv_obj_t * obj);
     static void refr_obj_matrix(lv_layer_t * layer, lv_obj_t * obj);
@@ -60,6 +89,9 @@ static bool alpha_test_area_on_obj(lv_obj_t * obj, const lv_area_t * area);
 /**********************
  *  STATIC VARIABLES
  **********************/
+#if LV_USE_REFR_OCCLUSION
+    static refr_occlusion_t occlusion;
+#endif
 
 /**********************
  *      MACROS
@@ -121,9 +153,19 @@ void lv_obj_redraw(lv_layer_t * layer, lv_obj_t * obj)
     /*If the object is visible on the current clip area*/
     layer->_clip_area = clip_coords_for_obj;
 
-    lv_obj_send_event(obj, LV_EVENT_DRAW_MAIN_BEGIN, layer);
-    lv_obj_send_event(obj, LV_EVENT_DRAW_MAIN, layer);
-    lv_obj_send_event(obj, LV_EVENT_DRAW_MAIN_END, layer);
+    bool draw_main = true;
+#if LV_USE_REFR_OCCLUSION
+    /*Skip the main part if the children or the widgets drawn later hide it*/
+    if(layer == occlusion.layer && occlusion_area_is_hidden(&clip_coords_for_obj, obj, true)) {
+        draw_main = false;
+    }
+#endif
+
+    if(draw_main) {
+        lv_obj_send_event(obj, LV_EVENT_DRAW_MAIN_BEGIN, layer);
+        lv_obj_send_event(obj, LV_EVENT_DRAW_MAIN, layer);
+        lv_obj_send_event(obj, LV_EVENT_DRAW_MAIN_END, layer);
+    }
 #if LV_USE_REFR_DEBUG
     lv_color_t debug_color = lv_color_make(lv_rand(0, 0xFF), lv_rand(0, 0xFF), lv_rand(0, 0xFF));
     lv_draw_rect_dsc_t draw_dsc;
@@ -284,6 +326,12 @@ void lv_inv_area(lv_display_t * disp, const lv_area_t * area_p)
     /*Clear the invalidate buffer if the parameter is NULL*/
     if(area_p == NULL) {
         disp->inv_p = 0;
+#if LV_USE_REFR_TILE_MAP
+        if(disp->tile_map) {
+            lv_memzero(disp->tile_map, disp->tile_map_stride * disp->tile_map_rows * sizeof(uint32_t));
+        }
+        disp->tile_map_dirty = 0;
+#endif
         return;
     }
 
@@ -317,6 +365,14 @@ void lv_inv_area(lv_display_t * disp, const lv_area_t * area_p)
     lv_result_t res = lv_display_send_event(disp, LV_EVENT_INVALIDATE_AREA, &com_area);
     if(res != LV_RESULT_OK) return;
 
+#if LV_USE_REFR_TILE_MAP
+    /*If the area list has already overflowed collect the areas in the tile map until the next refresh*/
+    if(disp->tile_map_dirty && tile_map_invalidate(disp, &com_area)) {
+        lv_display_send_event(disp, LV_EVENT_REFR_REQUEST, NULL);
+        return;
+    }
+#endif
+
     /*Save only if this area is not in one of the saved areas*/
     uint16_t i;
     for(i = 0; i < disp->inv_p; i++) {
@@ -326,6 +382,17 @@ void lv_inv_area(lv_display_t * disp, const lv_area_t * area_p)
     /*Save the area*/
     lv_area_t * tmp_area_p = &com_area;
     if(disp->inv_p >= LV_INV_BUF_SIZE) { /*If no place for the area add the screen*/
+#if LV_USE_REFR_TILE_MAP
+        /*Move the listed areas to the tile map instead, if it can be allocated*/
+        if(tile_map_invalidate(disp, &com_area)) {
+            for(i = 0; i < disp->inv_p; i++) {
+                tile_map_invalidate(disp, &disp->inv_areas[i]);
+            }
+            disp->inv_p = 0;
+            lv_display_send_event(disp, LV_EVENT_REFR_REQUEST, NULL);
+            return;
+        }
+#endif
         disp->inv_p = 0;
         tmp_area_p = &scr_area;
     }
@@ -384,8 +451,15 @@ void lv_display_refr_timer(lv_timer_t * tmr)
         return;
     }
 
+    lv_memzero(&disp_refr->refr_stats, sizeof(disp_refr->refr_stats));
+
     lv_display_send_event(disp_refr, LV_EVENT_REFR_START, NULL);
 
+#if LV_USE_OBSERVER
+    /*Apply the latest values of the batched subjects before the layout is updated*/
+    lv_subject_notify_batched();
+#endif
+
     /*Refresh the screen's layout if required*/
     LV_PROFILER_LAYOUT_BEGIN_TAG("layout");
     lv_obj_update_layout(disp_refr->act_scr);
@@ -399,11 +473,23 @@ void lv_display_refr_timer(lv_timer_t * tmr)
     /*Do nothing if there is no active screen*/
     if(disp_refr->act_scr == NULL) {
         disp_refr->inv_p = 0;
+#if LV_USE_REFR_TILE_MAP
+        if(disp_refr->tile_map) {
+            lv_memzero(disp_refr->tile_map, disp_refr->tile_map_stride * disp_refr->tile_map_rows * sizeof(uint32_t));
+        }
+        disp_refr->tile_map_dirty = 0;
+#endif
         LV_LOG_WARN("there is no active screen");
         goto refr_finish;
     }
 
+#if LV_USE_REFR_TILE_MAP
+    /*The rectangles of the tile map don't overlap, so they don't need to be joined*/
+    if(disp_refr->tile_map_dirty) refr_tile_map_to_areas();
+    else lv_refr_join_area();
+#else
     lv_refr_join_area();
+#endif
     refr_sync_areas();
     refr_invalid_areas();
 
@@ -437,6 +523,18 @@ refr_finish:
     LV_PROFILER_REFR_END;
 }
 
+void lv_refr_get_stats(lv_display_t * disp, lv_refr_stats_t * stats)
+{
+    LV_ASSERT_NULL(stats);
+    if(!disp) disp = lv_display_get_default();
+    if(!disp) {
+        lv_memzero(stats, sizeof(lv_refr_stats_t));
+        return;
+    }
+
+    *stats = disp->refr_stats;
+}
+
 /**
  * Search the most top object which fully covers an area
  * @param area_p pointer to an area
@@ -486,6 +584,13 @@ void lv_obj_refr(lv_layer_t * layer, lv_obj_t * obj)
     LV_ASSERT_NULL(obj);
     if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return;
 
+#if LV_USE_REFR_OCCLUSION
+    if(layer == occlusion.layer && occlusion_obj_is_hidden(layer, obj)) {
+        disp_refr->refr_stats.obj_occluded++;
+        return;
+    }
+#endif
+
     /*If `opa_layered != LV_OPA_COVER` draw the widget on a new layer and blend that layer with the given opacity.*/
     const lv_opa_t opa_layered = lv_obj_get_style_opa_layered(obj, LV_PART_MAIN);
     if(opa_layered <= LV_OPA_MIN) return;
@@ -503,7 +608,7 @@ void lv_obj_refr(lv_layer_t * layer, lv_obj_t * obj)
 
     lv_layer_type_t layer_type = lv_obj_get_layer_type(obj);
     if(layer_type == LV_LAYER_TYPE_NONE) {
-        lv_obj_redraw(layer, obj);
+        refr_obj_redraw(layer, obj);
     }
 #if LV_DRAW_TRANSFORM_USE_MATRIX
     /*If the layer opa is full then use the matrix transform*/
@@ -549,7 +654,7 @@ void lv_obj_refr(lv_layer_t * layer, lv_obj_t * obj)
 
             lv_layer_t * new_layer = lv_draw_layer_create(layer,
                                                           area_need_alpha ? LV_COLOR_FORMAT_ARGB8888 : LV_COLOR_FORMAT_NATIVE, &layer_area_act);
-            lv_obj_redraw(new_layer, obj);
+            refr_obj_redraw(new_layer, obj);
 
             lv_point_t pivot = {
                 .x = lv_obj_get_style_transform_pivot_x(obj, 0),
@@ -769,6 +874,7 @@ static void refr_invalid_areas(void)
 
         if(i == last_i) disp_refr->last_area = 1;
         disp_refr->last_part = 0;
+        disp_refr->refr_stats.area_cnt++;
 
         lv_area_t inv_a = disp_refr->inv_areas[i];
         if(disp_refr->render_mode == LV_DISPLAY_RENDER_MODE_PARTIAL) {
@@ -815,6 +921,11 @@ static void refr_invalid_areas(void)
         }
     }
 
+#if LV_USE_OBJ_RENDER_CACHE
+    /*All draw tasks are ready so the cached images can be dropped again*/
+    lv_obj_render_cache_release_pinned();
+#endif
+
     lv_display_send_event(disp_refr, LV_EVENT_RENDER_READY, NULL);
     disp_refr->rendering_in_progress = false;
     LV_PROFILER_REFR_END;
@@ -942,6 +1053,7 @@ static void refr_area(const lv_area_t * area_p, int32_t y_offset)
     }
 
     disp_refr->refreshed_area = *area_p;
+    disp_refr->refr_stats.px_rendered += lv_area_get_size(area_p);
     LV_PROFILER_REFR_END;
 }
 
@@ -1030,6 +1142,10 @@ static void refr_configured_layer(lv_layer_t * layer)
         top_prev_scr = lv_refr_get_top_obj(&layer->_clip_area, disp_refr->prev_scr);
     }
 
+#if LV_USE_REFR_OCCLUSION
+    occlusion_collect_all(layer);
+#endif
+
     /*Draw a bottom layer background if there is no top object*/
     if(top_act_scr == NULL && top_prev_scr == NULL) {
         refr_obj_and_children(layer, lv_display_get_layer_bottom(disp_refr));
@@ -1060,6 +1176,11 @@ static void refr_configured_layer(lv_layer_t * layer)
     refr_obj_and_children(layer, lv_display_get_layer_top(disp_refr));
     refr_obj_and_children(layer, lv_display_get_layer_sys(disp_refr));
 
+#if LV_USE_REFR_OCCLUSION
+    occlusion.layer = NULL;
+    occlusion.cnt = 0;
+#endif
+
     LV_PROFILER_REFR_END;
 }
 
@@ -1179,6 +1300,20 @@ static bool alpha_test_area_on_obj(lv_obj_t * obj, const lv_area_t * area)
     else return true;
 }
 
+/**
+ * Redraw a widget and its children or draw its cached image if it's enabled
+ * @param layer     pointer to a layer where drawing will be done
+ * @param obj       pointer to an object to redraw
+ */
+static void refr_obj_redraw(lv_layer_t * layer, lv_obj_t * obj)
+{
+#if LV_USE_OBJ_RENDER_CACHE
+    if(obj->render_cache && lv_obj_render_cache_draw(layer, obj) == LV_RESULT_OK) return;
+#endif
+
+    lv_obj_redraw(layer, obj);
+}
+
 #if LV_DRAW_TRANSFORM_USE_MATRIX
 
 static bool obj_get_matrix(lv_obj_t * obj, lv_matrix_t * matrix)
@@ -1270,7 +1405,7 @@ static void refr_obj_matrix(lv_layer_t * layer, lv_obj_t * obj)
     layer->_clip_area = clip_area;
 
     /* redraw obj */
-    lv_obj_redraw(layer, obj);
+    refr_obj_redraw(layer, obj);
 
     /* restore original matrix */
     layer->matrix = ori_matrix;
@@ -1304,6 +1439,343 @@ static bool refr_check_obj_clip_overflow(lv_layer_t * layer, lv_obj_t * obj)
 
 #endif /* LV_DRAW_TRANSFORM_USE_MATRIX */
 
+#if LV_USE_REFR_TILE_MAP
+
+/**
+ * Mark the tiles touched by an area as invalid. Allocate the tile map if required.
+ * @param disp      pointer to a display
+ * @param area_p    the area to invalidate. Already clipped to the screen.
+ * @return          true: the tiles are marked; false: the tile map couldn't be allocated
+ */
+static bool tile_map_invalidate(lv_display_t * disp, const lv_area_t * area_p)
+{
+    int32_t cols = (lv_display_get_horizontal_resolution(disp) + LV_REFR_TILE_MAP_TILE_SIZE - 1) /
+                   LV_REFR_TILE_MAP_TILE_SIZE;
+    int32_t rows = (lv_display_get_vertical_resolution(disp) + LV_REFR_TILE_MAP_TILE_SIZE - 1) /
+                   LV_REFR_TILE_MAP_TILE_SIZE;
+
+    if(disp->tile_map == NULL || disp->tile_map_cols != cols || disp->tile_map_rows != rows) {
+        lv_free(disp->tile_map);
+        disp->tile_map_stride = (cols + 31) / 32;
+        disp->tile_map = lv_malloc_zeroed(disp->tile_map_stride * rows * sizeof(uint32_t));
+        disp->tile_map_dirty = 0;
+        if(disp->tile_map == NULL) {
+            LV_LOG_WARN("Couldn't allocate the tile map, using the area list");
+            return false;
+        }
+        disp->tile_map_cols = cols;
+        disp->tile_map_rows = rows;
+    }
+
+    int32_t tx1 = area_p->x1 / LV_REFR_TILE_MAP_TILE_SIZE;
+    int32_t tx2 = area_p->x2 / LV_REFR_TILE_MAP_TILE_SIZE;
+    int32_t ty1 = area_p->y1 / LV_REFR_TILE_MAP_TILE_SIZE;
+    int32_t ty2 = area_p->y2 / LV_REFR_TILE_MAP_TILE_SIZE;
+    if(tx2 >= cols) tx2 = cols - 1;
+    if(ty2 >= rows) ty2 = rows - 1;
+
+    int32_t tx;
+    int32_t ty;
+    for(ty = ty1; ty <= ty2; ty++) {
+        uint32_t * row = &disp->tile_map[ty * disp->tile_map_stride];
+        for(tx = tx1; tx <= tx2; tx++) {
+            row[tx >> 5] |= (uint32_t)1 << (tx & 0x1F);
+        }
+    }
+
+    disp->tile_map_dirty = 1;
+    return true;
+}
+
+/**
+ * Convert the invalidated tiles to rectangles in `inv_areas` and clear the tile map.
+ * Each row of tiles is split into horizontal runs and a run extends the rectangle of the
+ * previous row if it has the same horizontal span. This way e.g. a column of labels results
+ * in only one rectangle.
+ */
+static void refr_tile_map_to_areas(void)
+{
+    lv_display_t * disp = disp_refr;
+    if(disp->tile_map == NULL || disp->tile_map_dirty == 0) return;
+
+    LV_PROFILER_REFR_BEGIN;
+    int32_t x_max = lv_display_get_horizontal_resolution(disp) - 1;
+    int32_t y_max = lv_display_get_vertical_resolution(disp) - 1;
+    uint32_t first_area = disp->inv_p;
+
+    int32_t ty;
+    for(ty = 0; ty < disp->tile_map_rows; ty++) {
+        const uint32_t * row = &disp->tile_map[ty * disp->tile_map_stride];
+        lv_area_t run;
+        run.y1 = ty * LV_REFR_TILE_MAP_TILE_SIZE;
+        run.y2 = LV_MIN(run.y1 + LV_REFR_TILE_MAP_TILE_SIZE - 1, y_max);
+
+        int32_t tx = 0;
+        while(tx < disp->tile_map_cols) {
+            /*Skip the clean tiles, 32 at once if possible*/
+            if((tx & 0x1F) == 0 && row[tx >> 5] == 0) {
+                tx += 32;
+                continue;
+            }
+            if((row[tx >> 5] & ((uint32_t)1 << (tx & 0x1F))) == 0) {
+                tx++;
+                continue;
+            }
+
+            int32_t tx_start = tx;
+            while(tx < disp->tile_map_cols && (row[tx >> 5] & ((uint32_t)1 << (tx & 0x1F)))) tx++;
+
+            run.x1 = tx_start * LV_REFR_TILE_MAP_TILE_SIZE;
+            run.x2 = LV_MIN(tx * LV_REFR_TILE_MAP_TILE_SIZE - 1, x_max);
+
+            /*Extend a rectangle ending in the previous row of tiles if it has the same span*/
+            uint32_t i;
+            for(i = first_area; i < disp->inv_p; i++) {
+                lv_area_t * a = &disp->inv_areas[i];
+                if(a->y2 == run.y1 - 1 && a->x1 == run.x1 && a->x2 == run.x2) break;
+            }
+
+            if(i < disp->inv_p) {
+                disp->inv_areas[i].y2 = run.y2;
+            }
+            else if(disp->inv_p < LV_INV_BUF_SIZE) {
+                disp->inv_areas[disp->inv_p] = run;
+                disp->inv_p++;
+            }
+            else {
+                /*No more free areas: grow the last one. It redraws more but it's still correct.*/
+                lv_area_t * last = &disp->inv_areas[LV_INV_BUF_SIZE - 1];
+                lv_area_join(last, last, &run);
+            }
+        }
+    }
+
+    lv_memzero(disp->tile_map, disp->tile_map_stride * disp->tile_map_rows * sizeof(uint32_t));
+    disp->tile_map_dirty = 0;
+    LV_PROFILER_REFR_END;
+}
+
+#endif /*LV_USE_REFR_TILE_MAP*/
+
+#if LV_USE_REFR_OCCLUSION
+
+/**
+ * Collect the areas of the layer which are fully covered by opaque widgets
+ * @param layer     the layer which is about to be rendered
+ */
+static void occlusion_collect_all(lv_layer_t * layer)
+{
+    occlusion.cnt = 0;
+
+    /*During screen load animations two screens are drawn over each other, don't bother with it*/
+    if(disp_refr->prev_scr) {
+        occlusion.layer = NULL;
+        return;
+    }
+
+    LV_PROFILER_REFR_BEGIN;
+    occlusion.layer = layer;
+    occlusion_collect(disp_refr->act_scr, &layer->_clip_area, 0);
+    occlusion_collect(disp_refr->top_layer, &layer->_clip_area, 0);
+    occlusion_collect(disp_refr->sys_layer, &layer->_clip_area, 0);
+    LV_PROFILER_REFR_END;
+}
+
+/**
+ * Add an object and its children to the occluders if they fully cover a part of the clip area
+ * @param obj       the object to check
+ * @param clip      the area where the object is visible
+ * @param depth     number of ancestors of `obj`
+ */
+static void occlusion_collect(lv_obj_t * obj, const lv_area_t * clip, int32_t depth)
+{
+    if(obj == NULL) return;
+    if(occlusion.cnt >= LV_REFR_OCCLUSION_MAX) return;
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return;
+
+    lv_area_t obj_clip;
+    if(!lv_area_intersect(&obj_clip, clip, &obj->coords)) return;
+
+    /*Widgets drawn to a layer are blended later, so neither they nor their children hide anything*/
+    if(lv_obj_get_layer_type(obj) != LV_LAYER_TYPE_NONE) return;
+    if(lv_obj_get_style_opa(obj, LV_PART_MAIN) < LV_OPA_MAX) return;
+
+    lv_cover_check_info_t info;
+    info.res = LV_COVER_RES_COVER;
+    info.area = &obj_clip;
+    lv_obj_send_event(obj, LV_EVENT_COVER_CHECK, &info);
+    if(info.res == LV_COVER_RES_MASKED) return;
+
+    /*The screens and layers are drawn first anyway*/
+    if(info.res == LV_COVER_RES_COVER && depth > 0) {
+        refr_occluder_t * occ = &occlusion.occluders[occlusion.cnt];
+        occ->area = obj_clip;
+        occ->obj = obj;
+        occ->depth = depth;
+        occlusion.cnt++;
+    }
+
+    /*The children are clipped to the object's coordinates (or extended draw area) when drawn*/
+    lv_area_t clip_children = obj_clip;
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE)) {
+        int32_t ext_draw_size = lv_obj_get_ext_draw_size(obj);
+        lv_obj_get_coords(obj, &clip_children);
+        lv_area_increase(&clip_children, ext_draw_size, ext_draw_size);
+        if(!lv_area_intersect(&clip_children, &clip_children, clip)) return;
+    }
+
+    /*With clipped corners the top and bottom `radius` high strips of the children are drawn
+     *to a masked layer, so only the middle part is drawn directly (see lv_obj_refr())*/
+    if(lv_obj_get_style_clip_corner(obj, LV_PART_MAIN)) {
+        int32_t radius = lv_obj_get_style_radius(obj, LV_PART_MAIN);
+        if(radius > 0) {
+            int32_t short_side = LV_MIN(lv_area_get_width(&obj->coords), lv_area_get_height(&obj->coords));
+            int32_t rout = LV_MIN(radius, short_side >> 1);
+            lv_area_t mid = obj->coords;
+            mid.y1 += rout;
+            mid.y2 -= rout;
+            if(!lv_area_intersect(&clip_children, &clip_children, &mid)) return;
+        }
+    }
+
+    uint32_t i;
+    uint32_t child_cnt = lv_obj_get_child_count(obj);
+    for(i = 0; i < child_cnt; i++) {
+        occlusion_collect(obj->spec_attr->children[i], &clip_children, depth + 1);
+    }
+}
+
+static int32_t occlusion_get_depth(const lv_obj_t * obj)
+{
+    int32_t depth = 0;
+    while(obj->parent) {
+        obj = obj->parent;
+        depth++;
+    }
+    return depth;
+}
+
+static uint32_t occlusion_get_root_order(const lv_obj_t * root)
+{
+    if(root == disp_refr->bottom_layer) return 0;
+    if(root == disp_refr->top_layer) return 2;
+    if(root == disp_refr->sys_layer) return 3;
+    return 1;
+}
+
+/**
+ * Check if an occluder is drawn after an object
+ * @param occ       pointer to an occluder
+ * @param obj       the object to check
+ * @param depth     number of ancestors of `obj`
+ * @param main_only true: consider only the main part of `obj`, so its descendants are drawn after it;
+ *                  false: consider `obj` with all its descendants
+ * @return          true: `occ` is drawn later
+ */
+static bool occlusion_is_above(const refr_occluder_t * occ, const lv_obj_t * obj, int32_t depth, bool main_only)
+{
+    const lv_obj_t * occ_anc = occ->obj;
+    int32_t occ_depth = occ->depth;
+    while(occ_depth > depth) {
+        occ_anc = occ_anc->parent;
+        occ_depth--;
+    }
+
+    /*The descendants are drawn after the main part but before the post draw of `obj`*/
+    if(occ_anc == obj) return main_only && occ->obj != obj;
+
+    while(depth > occ_depth) {
+        obj = obj->parent;
+        depth--;
+    }
+
+    /*The ancestors are drawn before `obj`*/
+    if(occ_anc == obj) return false;
+
+    /*Find the siblings and compare their order*/
+    while(occ_anc->parent != obj->parent) {
+        occ_anc = occ_anc->parent;
+        obj = obj->parent;
+    }
+
+    if(obj->parent == NULL) return occlusion_get_root_order(occ_anc) > occlusion_get_root_order(obj);
+    else return lv_obj_get_index(occ_anc) > lv_obj_get_index(obj);
+}
+
+/**
+ * Check if an area is fully hidden by the union of the occluders drawn after an object
+ * @param area      the area to check
+ * @param obj       the object drawing on `area`
+ * @param main_only true: check only the main part of `obj`; false: check `obj` and its descendants
+ * @return          true: `area` is hidden
+ */
+static bool occlusion_area_is_hidden(const lv_area_t * area, const lv_obj_t * obj, bool main_only)
+{
+    if(occlusion.cnt == 0) return false;
+
+    lv_area_t pieces[2][OCCLUSION_PIECE_MAX];
+    uint32_t piece_cnt = 1;
+    uint32_t act = 0;
+    pieces[act][0] = *area;
+
+    int32_t depth = -1;
+    uint32_t i;
+    for(i = 0; i < occlusion.cnt; i++) {
+        const refr_occluder_t * occ = &occlusion.occluders[i];
+        if(!lv_area_is_on(&occ->area, area)) continue;
+
+        if(depth < 0) depth = occlusion_get_depth(obj);
+        if(!occlusion_is_above(occ, obj, depth, main_only)) continue;
+
+        /*Cut the occluder from the not yet hidden pieces*/
+        uint32_t new_cnt = 0;
+        uint32_t j;
+        for(j = 0; j < piece_cnt; j++) {
+            lv_area_t res[4];
+            int8_t res_cnt = lv_area_diff(res, &pieces[act][j], &occ->area);
+            if(res_cnt < 0) {
+                res[0] = pieces[act][j];
+                res_cnt = 1;
+            }
+
+            if(new_cnt + res_cnt > OCCLUSION_PIECE_MAX) return false;
+            lv_memcpy(&pieces[act ^ 1][new_cnt], res, res_cnt * sizeof(lv_area_t));
+            new_cnt += res_cnt;
+        }
+
+        if(new_cnt == 0) return true;
+        piece_cnt = new_cnt;
+        act ^= 1;
+    }
+
+    return false;
+}
+
+/**
+ * Check if an object with all its children is hidden by the occluders on a layer
+ * @param layer     the layer where the object would be drawn
+ * @param obj       the object to check
+ * @return          true: the object doesn't need to be drawn
+ */
+static bool occlusion_obj_is_hidden(lv_layer_t * layer, lv_obj_t * obj)
+{
+    if(occlusion.cnt == 0) return false;
+
+    lv_area_t obj_area;
+    int32_t ext_draw_size = lv_obj_get_ext_draw_size(obj);
+    lv_obj_get_coords(obj, &obj_area);
+    lv_area_increase(&obj_area, ext_draw_size, ext_draw_size);
+    if(lv_obj_get_layer_type(obj) == LV_LAYER_TYPE_TRANSFORM) {
+        lv_obj_get_transformed_area(obj, &obj_area, LV_OBJ_POINT_TRANSFORM_FLAG_NONE);
+    }
+
+    if(!lv_area_intersect(&obj_area, &obj_area, &layer->_clip_area)) return false;
+
+    return occlusion_area_is_hidden(&obj_area, obj, false);
+}
+
+#endif /*LV_USE_REFR_OCCLUSION*/
+
 static uint32_t get_max_row(lv_display_t * disp, int32_t area_w, int32_t area_h)
 {
     lv_color_format_t cf = disp->color_format;
@@ -1415,6 +1887,7 @@ static void call_flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t *
 #endif
 
     disp->flush_cb(disp, &offset_area, px_map);
+    disp->refr_stats.px_flushed += lv_area_get_size(&offset_area);
     lv_display_send_event(disp, LV_EVENT_FLUSH_FINISH, &offset_area);
 
     LV_PROFILER_REFR_END;
@@ -25,6 +25,18 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+/** Statistics of the last refresh of a display*/
+typedef struct {
+    uint32_t area_cnt;      /**< Number of areas (rectangles) refreshed*/
+    uint32_t px_rendered;   /**< Number of pixels rendered*/
+    uint32_t px_flushed;    /**< Number of pixels passed to the `flush_cb`*/
+    uint32_t obj_occluded;  /**< Number of widgets skipped because opaque widgets hid them*/
+    uint32_t task_cnt;      /**< Number of draw tasks added*/
+    uint32_t task_merged;   /**< Number of draw tasks merged into another one (`LV_DRAW_OPTIMIZE_TASKS`)*/
+    uint32_t task_dropped;  /**< Number of draw tasks dropped as a later opaque fill covers them*/
+    uint32_t task_reordered; /**< Number of draw tasks moved next to a task of the same type*/
+} lv_refr_stats_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -63,6 +75,13 @@ void lv_obj_redraw(lv_layer_t * layer, lv_obj_t * obj);
  */
 void lv_display_refr_timer(lv_timer_t * timer);
 
+/**
+ * Get the statistics of the last refresh of a display
+ * @param disp      pointer to a display. NULL to use the default display.
+ * @param stats     store the statistics here
+ */
+void lv_refr_get_stats(lv_display_t * disp, lv_refr_stats_t * stats);
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
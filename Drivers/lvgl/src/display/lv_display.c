@@ -219,6 +219,10 @@ void lv_display_delete(lv_display_t * disp)
     if(disp->layer_deinit) disp->layer_deinit(disp, disp->layer_head);
     lv_free(disp->layer_head);
 
+#if LV_USE_REFR_TILE_MAP
+    lv_free(disp->tile_map);
+#endif
+
     lv_free(disp);
 
     if(was_default) lv_display_set_default(lv_ll_get_head(disp_ll_p));
@@ -1271,6 +1275,12 @@ static void update_resolution(lv_display_t * disp)
     lv_memzero(disp->inv_areas, sizeof(disp->inv_areas));
     lv_memzero(disp->inv_area_joined, sizeof(disp->inv_area_joined));
     disp->inv_p = 0;
+#if LV_USE_REFR_TILE_MAP
+    /*Will be allocated again with the new size on the next invalidation*/
+    lv_free(disp->tile_map);
+    disp->tile_map = NULL;
+    disp->tile_map_dirty = 0;
+#endif
     lv_obj_invalidate(disp->sys_layer);
 
     lv_obj_tree_walk(NULL, invalidate_layout_cb, NULL);
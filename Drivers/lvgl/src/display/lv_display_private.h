@@ -17,6 +17,7 @@ extern "C" {
 #include "../core/lv_obj.h"
 #include "../draw/lv_draw.h"
 #include "lv_display.h"
+#include "../core/lv_refr.h"
 
 #if LV_USE_SYSMON
 #include "../others/sysmon/lv_sysmon_private.h"
@@ -107,6 +108,15 @@ struct _lv_display_t {
     uint32_t inv_p;
     int32_t inv_en_cnt;
 
+#if LV_USE_REFR_TILE_MAP
+    /** One bit per `LV_REFR_TILE_MAP_TILE_SIZE` sized tile. Used when `inv_areas` overflows.*/
+    uint32_t * tile_map;
+    uint32_t tile_map_stride;   /**< Number of `uint32_t` words in a row of tiles*/
+    int32_t tile_map_cols;
+    int32_t tile_map_rows;
+    uint32_t tile_map_dirty : 1;/**< 1: the area list has overflowed and the tile map is in use*/
+#endif
+
     /** Double buffer sync areas (redrawn during last refresh) */
     lv_ll_t sync_areas;
 
@@ -161,6 +171,9 @@ struct _lv_display_t {
     lv_area_t refreshed_area;
     uint32_t vsync_count;
 
+    /** Statistics of the last refresh*/
+    lv_refr_stats_t refr_stats;
+
 #if LV_USE_PERF_MONITOR
     lv_obj_t * perf_label;
     lv_sysmon_backend_data_t perf_sysmon_backend;
@@ -27,6 +27,9 @@
  *********************/
 #define _draw_info LV_GLOBAL_DEFAULT()->draw_info
 
+/*Number of preceding draw tasks to check when a task is merged or moved*/
+#define OPTIMIZE_WINDOW 16
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -38,6 +41,23 @@ static bool is_independent(lv_layer_t * layer, lv_draw_task_t * t_check);
 static void cleanup_task(lv_draw_task_t * t, lv_display_t * disp);
 static inline size_t get_draw_dsc_size(lv_draw_task_type_t type);
 static lv_draw_task_t * get_first_available_task(lv_layer_t * layer);
+#if LV_DRAW_LAYER_ARENA_SIZE > 0
+    static lv_draw_buf_t * layer_arena_alloc(uint32_t w, uint32_t h, lv_color_format_t cf);
+    static bool layer_arena_release(lv_draw_buf_t * draw_buf);
+#endif
+#if LV_DRAW_OPTIMIZE_TASKS
+    static void dispatch_collected_tasks(lv_layer_t * layer);
+    static void optimize_tasks(lv_display_t * disp, lv_layer_t * layer);
+    static uint32_t drop_covered_tasks(lv_draw_task_t ** win, uint32_t * win_cnt, uint32_t end,
+                                       const lv_area_t * area);
+    static int32_t find_fill_to_merge(lv_draw_task_t ** win, int32_t end, const lv_draw_task_t * t,
+                                      lv_area_t * area);
+    static bool get_opaque_fill_area(const lv_draw_task_t * t, lv_area_t * area);
+    static bool get_droppable_area(const lv_draw_task_t * t, lv_area_t * area);
+    static bool get_rect_union(lv_area_t * res, const lv_area_t * a1, const lv_area_t * a2);
+    static bool get_draw_area(const lv_draw_task_t * t, lv_area_t * area);
+    static bool is_overlapping(const lv_draw_task_t * t, const lv_area_t * area);
+#endif
 
 #if LV_LOG_LEVEL <= LV_LOG_LEVEL_INFO
 static inline uint32_t get_layer_size_kb(uint32_t size_byte)
@@ -49,6 +69,9 @@ static inline uint32_t get_layer_size_kb(uint32_t size_byte)
 /**********************
  *  STATIC VARIABLES
  **********************/
+#if LV_DRAW_LAYER_ARENA_SIZE > 0
+    static LV_ATTRIBUTE_DRAW_LAYER_ARENA uint64_t layer_arena[LV_DRAW_LAYER_ARENA_SIZE / sizeof(uint64_t)];
+#endif
 
 /**********************
  *      MACROS
@@ -63,6 +86,9 @@ void lv_draw_init(void)
 #if LV_USE_OS
     lv_thread_sync_init(&_draw_info.sync);
 #endif
+#if LV_DRAW_LAYER_ARENA_SIZE > 0
+    lv_mutex_init(&_draw_info.layer_arena_mutex);
+#endif
 }
 
 void lv_draw_deinit(void)
@@ -70,6 +96,9 @@ void lv_draw_deinit(void)
 #if LV_USE_OS
     lv_thread_sync_delete(&_draw_info.sync);
 #endif
+#if LV_DRAW_LAYER_ARENA_SIZE > 0
+    lv_mutex_delete(&_draw_info.layer_arena_mutex);
+#endif
 
     lv_draw_unit_t * u = _draw_info.unit_head;
     while(u) {
@@ -115,6 +144,12 @@ lv_draw_task_t * lv_draw_add_task(lv_layer_t * layer, const lv_area_t * coords,
     new_task->draw_dsc = (uint8_t *)new_task + LV_ALIGN_UP(sizeof(lv_draw_task_t), 8);
     new_task->state = LV_DRAW_TASK_STATE_QUEUED;
 
+    lv_display_t * disp = lv_refr_get_disp_refreshing();
+    if(disp) disp->refr_stats.task_cnt++;
+#if LV_DRAW_OPTIMIZE_TASKS
+    layer->tasks_added++;
+#endif
+
     /*Find the tail*/
     if(layer->draw_task_head == NULL) {
         layer->draw_task_head = new_task;
@@ -169,7 +204,14 @@ void lv_draw_finalize_task_creation(lv_layer_t * layer, lv_draw_task_t * t)
             t->state = LV_DRAW_TASK_STATE_READY;
         }
         else {
+#if LV_DRAW_OPTIMIZE_TASKS
+            /*Draw the tasks only when the layer is finished to optimize them together.
+             *To limit the memory usage draw the collected tasks if there are too many.*/
+            if(layer->tasks_added < LV_DRAW_OPTIMIZE_TASKS) lv_draw_dispatch_request();
+            else dispatch_collected_tasks(layer);
+#else
             lv_draw_dispatch();
+#endif
         }
     }
     else {
@@ -233,6 +275,14 @@ void lv_draw_dispatch(void)
 bool lv_draw_dispatch_layer(lv_display_t * disp, lv_layer_t * layer)
 {
     LV_PROFILER_DRAW_BEGIN;
+#if LV_DRAW_OPTIMIZE_TASKS
+    /*Optimize the new tasks before removing the tasks which became ready*/
+    if(layer->tasks_added) {
+        optimize_tasks(disp, layer);
+        layer->tasks_added = 0;
+    }
+#endif
+
     /*Remove the finished tasks first*/
     lv_draw_task_t * t_prev = NULL;
     lv_draw_task_t * t = layer->draw_task_head;
@@ -473,7 +523,13 @@ void * lv_draw_layer_alloc_buf(lv_layer_t * layer)
     }
 #endif
 
+#if LV_DRAW_LAYER_ARENA_SIZE > 0
+    layer->draw_buf = layer_arena_alloc(w, h, layer->color_format);
+    /*Use the heap if the arena is full*/
+    if(layer->draw_buf == NULL) layer->draw_buf = lv_draw_buf_create(w, h, layer->color_format, 0);
+#else
     layer->draw_buf = lv_draw_buf_create(w, h, layer->color_format, 0);
+#endif
 
     if(layer->draw_buf == NULL) {
         LV_LOG_WARN("Allocating layer buffer failed. Try later");
@@ -620,7 +676,11 @@ static void cleanup_task(lv_draw_task_t * t, lv_display_t * disp)
                 LV_LOG_WARN("More layers were freed than allocated");
             }
             LV_LOG_INFO("Layer memory used: %" LV_PRIu32 " kB", get_layer_size_kb(_draw_info.used_memory_for_layers));
+#if LV_DRAW_LAYER_ARENA_SIZE > 0
+            if(!layer_arena_release(layer_drawn->draw_buf)) lv_draw_buf_destroy(layer_drawn->draw_buf);
+#else
             lv_draw_buf_destroy(layer_drawn->draw_buf);
+#endif
             layer_drawn->draw_buf = NULL;
         }
 
@@ -648,11 +708,74 @@ static void cleanup_task(lv_draw_task_t * t, lv_display_t * disp)
         lv_free((void *)draw_label_dsc->text);
         draw_label_dsc->text = NULL;
     }
+    lv_draw_line_dsc_t * draw_line_dsc = lv_draw_task_get_line_dsc(t);
+    if(draw_line_dsc && draw_line_dsc->points_owned) {
+        lv_free((void *)draw_line_dsc->points);
+        draw_line_dsc->points = NULL;
+    }
 
     lv_free(t);
     LV_PROFILER_DRAW_END;
 }
 
+#if LV_DRAW_LAYER_ARENA_SIZE > 0
+/**
+ * Allocate a layer buffer and its descriptor from the layer arena.
+ * The arena is a bump allocator: the buffers are not freed one by one,
+ * but the whole arena is reset when the last buffer allocated from it is released.
+ * As all layers are drawn by the end of every refreshed area it happens at least once per frame.
+ * @param w         width of the layer
+ * @param h         height of the layer
+ * @param cf        color format of the layer
+ * @return          the draw buffer or NULL if it doesn't fit into the free part of the arena
+ */
+static lv_draw_buf_t * layer_arena_alloc(uint32_t w, uint32_t h, lv_color_format_t cf)
+{
+    uint32_t stride = lv_draw_buf_width_to_stride(w, cf);
+    uint32_t data_size = stride * h;
+    uint8_t * arena = (uint8_t *)layer_arena;
+    lv_draw_buf_t * draw_buf = NULL;
+
+    lv_mutex_lock(&_draw_info.layer_arena_mutex);
+
+    /*The descriptor is followed by the aligned pixel data*/
+    uint8_t * dsc_p = arena + _draw_info.layer_arena_used;
+    uint8_t * data = lv_draw_buf_align(dsc_p + sizeof(lv_draw_buf_t), cf);
+    uint32_t end = (uint32_t)(data - arena) + data_size;
+    end = (end + sizeof(uint64_t) - 1) & ~(sizeof(uint64_t) - 1);
+
+    if(end <= sizeof(layer_arena)) {
+        draw_buf = (lv_draw_buf_t *)dsc_p;
+        lv_draw_buf_init(draw_buf, w, h, cf, stride, data, data_size);
+        _draw_info.layer_arena_used = end;
+        _draw_info.layer_arena_cnt++;
+    }
+
+    lv_mutex_unlock(&_draw_info.layer_arena_mutex);
+
+    return draw_buf;
+}
+
+/**
+ * Release a layer buffer allocated by `layer_arena_alloc()`.
+ * @param draw_buf  pointer to a draw buffer
+ * @return          false if the buffer is not in the arena and needs to be destroyed normally
+ */
+static bool layer_arena_release(lv_draw_buf_t * draw_buf)
+{
+    uint8_t * arena = (uint8_t *)layer_arena;
+    if((uint8_t *)draw_buf < arena || (uint8_t *)draw_buf >= arena + sizeof(layer_arena)) return false;
+
+    lv_mutex_lock(&_draw_info.layer_arena_mutex);
+    LV_ASSERT(_draw_info.layer_arena_cnt > 0);
+    _draw_info.layer_arena_cnt--;
+    if(_draw_info.layer_arena_cnt == 0) _draw_info.layer_arena_used = 0;
+    lv_mutex_unlock(&_draw_info.layer_arena_mutex);
+
+    return true;
+}
+#endif
+
 static lv_draw_task_t * get_first_available_task(lv_layer_t * layer)
 {
     LV_PROFILER_DRAW_BEGIN;
@@ -681,3 +804,305 @@ static lv_draw_task_t * get_first_available_task(lv_layer_t * layer)
     LV_PROFILER_DRAW_END;
     return t;
 }
+
+#if LV_DRAW_OPTIMIZE_TASKS
+/**
+ * Draw the tasks collected in a layer so far.
+ * Used if there are too many tasks to keep them until the layer is finished.
+ * @param layer     pointer to a layer
+ */
+static void dispatch_collected_tasks(lv_layer_t * layer)
+{
+    LV_PROFILER_DRAW_BEGIN;
+    /*Without a refreshed display the caller dispatches the layer, e.g. the canvas when its layer is finished*/
+    lv_display_t * disp = lv_refr_get_disp_refreshing();
+    if(disp) {
+        while(lv_draw_dispatch_layer(disp, layer)) {
+            lv_draw_dispatch_wait_for_request();
+        }
+    }
+
+    /*The remaining tasks are dispatched when the caller waits for the layer*/
+    lv_draw_dispatch_request();
+    LV_PROFILER_DRAW_END;
+}
+
+/**
+ * Optimize the queued draw tasks of a layer without changing the result:
+ * - drop the tasks which are covered by a later opaque fill,
+ * - merge the opaque fills with the same color into an earlier one if they form a rectangle together,
+ * - move the tasks next to an earlier task of the same type.
+ * A task can be moved before the tasks which don't overlap with it, but only
+ * the last `OPTIMIZE_WINDOW` not ready tasks are checked to keep it fast.
+ * The dropped and merged tasks are marked ready so they are removed without drawing.
+ * @param disp      pointer to the display whose statistics should be updated, or `NULL`
+ * @param layer     pointer to a layer
+ */
+static void optimize_tasks(lv_display_t * disp, lv_layer_t * layer)
+{
+    LV_PROFILER_DRAW_BEGIN;
+    /*The last not ready tasks before `t` in their order in the list. +1 for `t` before the oldest is removed*/
+    lv_draw_task_t * win[OPTIMIZE_WINDOW + 1];
+    uint32_t win_cnt = 0;
+    uint32_t merged_cnt = 0;
+    uint32_t dropped_cnt = 0;
+    uint32_t reordered_cnt = 0;
+
+    lv_draw_task_t * t_prev = NULL;
+    lv_draw_task_t * t = layer->draw_task_head;
+    while(t) {
+        lv_draw_task_t * t_next = t->next;
+        if(t->state == LV_DRAW_TASK_STATE_READY) {
+            t_prev = t;
+            t = t_next;
+            continue;
+        }
+
+        int32_t i;
+        bool moved = false;
+        lv_area_t fill_area;
+        if(get_opaque_fill_area(t, &fill_area)) {
+            /*Drop the earlier tasks which would be overwritten by this fill anyway*/
+            dropped_cnt += drop_covered_tasks(win, &win_cnt, win_cnt, &fill_area);
+
+            /*Merge into an earlier fill if it's not overlapping with the tasks between them.
+             *The merged fill is larger, so it might be merged further too.*/
+            lv_draw_task_t * t_src = t;
+            int32_t src_idx = (int32_t)win_cnt;     /*`t` is not in the window yet*/
+            while(1) {
+                i = find_fill_to_merge(win, src_idx, t_src, &fill_area);
+                if(i < 0) break;
+
+                win[i]->area = fill_area;
+                win[i]->_real_area = fill_area;
+                win[i]->clip_area = fill_area;
+                t_src->state = LV_DRAW_TASK_STATE_READY;
+                merged_cnt++;
+                if(t_src != t) {
+                    lv_memmove(&win[src_idx], &win[src_idx + 1], (win_cnt - src_idx - 1) * sizeof(win[0]));
+                    win_cnt--;
+                }
+
+                /*The larger fill might cover more tasks before it*/
+                uint32_t cnt = drop_covered_tasks(win, &win_cnt, i, &fill_area);
+                dropped_cnt += cnt;
+                src_idx = i - (int32_t)cnt;
+                t_src = win[src_idx];
+            }
+        }
+
+        lv_area_t t_area;
+        if(t->state == LV_DRAW_TASK_STATE_QUEUED && t->type != LV_DRAW_TASK_TYPE_LAYER && get_draw_area(t, &t_area)) {
+            /*Move it after the last task with the same type if it's not overlapping with the tasks between them*/
+            for(i = (int32_t)win_cnt - 1; i >= 0; i--) {
+                lv_draw_task_t * t_same = win[i];
+                if(t_same->type == t->type) {
+                    /*Only ready tasks might be between them if it's the last one*/
+                    if(i != (int32_t)win_cnt - 1) {
+                        t_prev->next = t_next;
+                        t->next = t_same->next;
+                        t_same->next = t;
+
+                        /*Keep the window in the order of the list*/
+                        lv_memmove(&win[i + 2], &win[i + 1], (win_cnt - i - 1) * sizeof(win[0]));
+                        win[i + 1] = t;
+                        moved = true;
+                        reordered_cnt++;
+                    }
+                    break;
+                }
+
+                if(is_overlapping(t_same, &t_area)) break;
+            }
+        }
+
+        if(moved) {
+            win_cnt++;
+        }
+        else if(t->state != LV_DRAW_TASK_STATE_READY) {
+            win[win_cnt] = t;
+            win_cnt++;
+        }
+
+        if(win_cnt > OPTIMIZE_WINDOW) {
+            lv_memmove(&win[0], &win[1], OPTIMIZE_WINDOW * sizeof(win[0]));
+            win_cnt--;
+        }
+
+        /*If `t` was moved, its previous task is the previous task of the next one*/
+        if(!moved) t_prev = t;
+        t = t_next;
+    }
+
+    if(disp) {
+        disp->refr_stats.task_merged += merged_cnt;
+        disp->refr_stats.task_dropped += dropped_cnt;
+        disp->refr_stats.task_reordered += reordered_cnt;
+    }
+    LV_PROFILER_DRAW_END;
+}
+
+/**
+ * Drop the tasks from the start of a window which are covered by an opaque fill drawn after them
+ * @param win       array of draw tasks
+ * @param win_cnt   number of tasks in `win`, decremented by the number of dropped tasks
+ * @param end       check the tasks before this index
+ * @param area      the area of the fill
+ * @return          number of dropped tasks
+ */
+static uint32_t drop_covered_tasks(lv_draw_task_t ** win, uint32_t * win_cnt, uint32_t end, const lv_area_t * area)
+{
+    uint32_t dropped_cnt = 0;
+    int32_t i;
+    for(i = (int32_t)end - 1; i >= 0; i--) {
+        lv_area_t a;
+        if(get_droppable_area(win[i], &a) && lv_area_is_in(&a, area, 0)) {
+            win[i]->state = LV_DRAW_TASK_STATE_READY;
+            lv_memmove(&win[i], &win[i + 1], (*win_cnt - i - 1) * sizeof(win[0]));
+            (*win_cnt)--;
+            dropped_cnt++;
+        }
+    }
+
+    return dropped_cnt;
+}
+
+/**
+ * Find an earlier opaque fill into which a fill can be merged
+ * @param win       array of draw tasks
+ * @param end       check the tasks before this index
+ * @param t         pointer to an opaque fill
+ * @param area      the area of `t`. The area of the merged fill is stored here.
+ * @return          index of the fill in `win` or -1 if not found.
+ *                  The tasks between the found fill and `t` don't overlap with `t`.
+ */
+static int32_t find_fill_to_merge(lv_draw_task_t ** win, int32_t end, const lv_draw_task_t * t, lv_area_t * area)
+{
+    const lv_draw_fill_dsc_t * dsc = t->draw_dsc;
+    int32_t i;
+    for(i = end - 1; i >= 0; i--) {
+        lv_draw_task_t * t_merge = win[i];
+        lv_area_t a;
+        if(t_merge->preferred_draw_unit_id == t->preferred_draw_unit_id &&
+           get_opaque_fill_area(t_merge, &a) &&
+           lv_color_eq(((lv_draw_fill_dsc_t *)t_merge->draw_dsc)->color, dsc->color) &&
+           get_rect_union(&a, &a, area)) {
+            *area = a;
+            return i;
+        }
+
+        if(is_overlapping(t_merge, area)) return -1;
+    }
+
+    return -1;
+}
+
+/**
+ * Check if a draw task is a queued fill which overwrites every pixel of its area
+ * @param t         pointer to a draw task
+ * @param area      store the area the fill covers here
+ * @return          true: `t` is an opaque fill without radius and gradient
+ */
+static bool get_opaque_fill_area(const lv_draw_task_t * t, lv_area_t * area)
+{
+    if(t->type != LV_DRAW_TASK_TYPE_FILL || t->state != LV_DRAW_TASK_STATE_QUEUED) return false;
+#if LV_DRAW_TRANSFORM_USE_MATRIX
+    if(!lv_matrix_is_identity(&t->matrix)) return false;
+#endif
+
+    const lv_draw_fill_dsc_t * dsc = t->draw_dsc;
+    if(dsc->radius != 0 || dsc->grad.dir != LV_GRAD_DIR_NONE || dsc->opa < LV_OPA_MAX) return false;
+
+    return lv_area_intersect(area, &t->area, &t->clip_area);
+}
+
+/**
+ * Check if a draw task is a queued task which can be dropped if it's covered
+ * @param t         pointer to a draw task
+ * @param area      store the area where the task can draw here
+ * @return          true: `t` can be dropped if `area` is covered.
+ *                  Layers and masks are never dropped as they have side effects.
+ */
+static bool get_droppable_area(const lv_draw_task_t * t, lv_area_t * area)
+{
+    if(t->state != LV_DRAW_TASK_STATE_QUEUED) return false;
+#if LV_DRAW_TRANSFORM_USE_MATRIX
+    if(!lv_matrix_is_identity(&t->matrix)) return false;
+#endif
+
+    switch(t->type) {
+        case LV_DRAW_TASK_TYPE_FILL:
+        case LV_DRAW_TASK_TYPE_BORDER:
+        case LV_DRAW_TASK_TYPE_BOX_SHADOW:
+        case LV_DRAW_TASK_TYPE_LETTER:
+        case LV_DRAW_TASK_TYPE_LABEL:
+        case LV_DRAW_TASK_TYPE_IMAGE:
+        case LV_DRAW_TASK_TYPE_LINE:
+        case LV_DRAW_TASK_TYPE_ARC:
+        case LV_DRAW_TASK_TYPE_TRIANGLE:
+            break;
+        default:
+            return false;
+    }
+
+    return get_draw_area(t, area);
+}
+
+/**
+ * Get the area where a draw task might change the pixels
+ * @param t         pointer to a draw task
+ * @param area      store the area here
+ * @return          false: `t` doesn't draw anything
+ */
+static bool get_draw_area(const lv_draw_task_t * t, lv_area_t * area)
+{
+#if LV_DRAW_TRANSFORM_USE_MATRIX
+    /*A transformed task can draw anywhere on the layer*/
+    if(!lv_matrix_is_identity(&t->matrix)) {
+        *area = t->target_layer->buf_area;
+        return true;
+    }
+#endif
+
+    /*The lines of a label can overflow its area, only the clip area limits them*/
+    if(t->type == LV_DRAW_TASK_TYPE_LABEL) {
+        *area = t->clip_area;
+        return true;
+    }
+
+    return lv_area_intersect(area, &t->_real_area, &t->clip_area);
+}
+
+/**
+ * Check if a draw task might change the pixels of an area
+ * @param t         pointer to a draw task
+ * @param area      pointer to an area
+ * @return          true: `t` might draw on `area`
+ */
+static bool is_overlapping(const lv_draw_task_t * t, const lv_area_t * area)
+{
+    lv_area_t a;
+    return get_draw_area(t, &a) && lv_area_is_on(&a, area);
+}
+
+/**
+ * Join two areas if their union is a rectangle
+ * @param res       store the result here. Can be the same as `a1` or `a2`.
+ * @param a1        pointer to an area
+ * @param a2        pointer to an other area
+ * @return          true: the union is a rectangle; false: `res` is not changed
+ */
+static bool get_rect_union(lv_area_t * res, const lv_area_t * a1, const lv_area_t * a2)
+{
+    bool rect = false;
+    /*Touching or overlapping on top of each other*/
+    if(a1->x1 == a2->x1 && a1->x2 == a2->x2) rect = a1->y1 <= a2->y2 + 1 && a2->y1 <= a1->y2 + 1;
+    /*Touching or overlapping next to each other*/
+    else if(a1->y1 == a2->y1 && a1->y2 == a2->y2) rect = a1->x1 <= a2->x2 + 1 && a2->x1 <= a1->x2 + 1;
+    /*One contains the other*/
+    else rect = lv_area_is_in(a1, a2, 0) || lv_area_is_in(a2, a1, 0);
+
+    if(rect) lv_area_join(res, a1, a2);
+    return rect;
+}
+#endif
@@ -123,6 +123,11 @@ struct _lv_layer_t  {
 
     /** Opacity of the layer */
     lv_opa_t opa;
+
+#if LV_DRAW_OPTIMIZE_TASKS
+    /** Number of draw tasks added since the task list was optimized last time */
+    uint32_t tasks_added;
+#endif
 };
 
 typedef struct {
@@ -656,7 +656,7 @@ static void * buf_malloc(size_t size_bytes, lv_color_format_t color_format)
 
     /*Allocate larger memory to be sure it can be aligned as needed*/
     size_bytes += LV_DRAW_BUF_ALIGN - 1;
-    return lv_malloc(size_bytes);
+    return lv_malloc_region(size_bytes, LV_MEM_REGION_LARGE);
 }
 
 static void buf_free(void * buf)
@@ -43,6 +43,7 @@ typedef unsigned char cmd_state_t;
  *  STATIC PROTOTYPES
  **********************/
 static uint8_t hex_char_to_num(char hex);
+static const lv_draw_label_line_cache_t * get_line_cache(const lv_draw_label_dsc_t * dsc, int32_t w);
 
 /**********************
  *  STATIC VARIABLES
@@ -196,6 +197,112 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_letter(lv_layer_t * layer, lv_draw_letter_dsc
     LV_PROFILER_DRAW_END;
 }
 
+lv_result_t lv_draw_label_line_cache_update(lv_draw_label_line_cache_t * cache, const char * text,
+                                            const lv_font_t * font, int32_t letter_space, int32_t max_width, lv_text_flag_t flag)
+{
+    LV_ASSERT_NULL(cache);
+    LV_ASSERT_NULL(text);
+    LV_ASSERT_NULL(font);
+
+    /*The width is not used to break the lines in these cases*/
+    if(flag & (LV_TEXT_FLAG_EXPAND | LV_TEXT_FLAG_FIT)) max_width = LV_COORD_MAX;
+
+    /*FNV-1a hash of the text*/
+    uint32_t hash = 2166136261U;
+    uint32_t len;
+    for(len = 0; text[len] != '\0'; len++) {
+        hash = (hash ^ (uint8_t)text[len]) * 16777619U;
+    }
+
+    if(cache->lines && cache->text_hash == hash && cache->text_len == len && cache->font == font &&
+       cache->letter_space == letter_space && cache->max_width == max_width && cache->flag == flag) {
+        cache->text = text;
+        return LV_RESULT_OK;
+    }
+
+    LV_PROFILER_DRAW_BEGIN;
+
+    uint32_t line_cap = 4;
+    lv_draw_label_line_t * lines = lv_realloc(cache->lines, line_cap * sizeof(lv_draw_label_line_t));
+    if(lines == NULL) {
+        lv_draw_label_line_cache_reset(cache);
+        LV_PROFILER_DRAW_END;
+        return LV_RESULT_INVALID;
+    }
+
+    uint32_t line_cnt = 0;
+    uint32_t line_start = 0;
+    while(text[line_start] != '\0') {
+        /*Keep place for the closing line too*/
+        if(line_cnt + 2 > line_cap) {
+            line_cap *= 2;
+            lv_draw_label_line_t * new_lines = lv_realloc(lines, line_cap * sizeof(lv_draw_label_line_t));
+            if(new_lines == NULL) {
+                cache->lines = lines;
+                lv_draw_label_line_cache_reset(cache);
+                LV_PROFILER_DRAW_END;
+                return LV_RESULT_INVALID;
+            }
+            lines = new_lines;
+        }
+
+        uint32_t line_end = line_start + lv_text_get_next_line(&text[line_start], LV_TEXT_LEN_MAX, font, letter_space,
+                                                               max_width, NULL, flag);
+        lines[line_cnt].start = line_start;
+        lines[line_cnt].width = lv_text_get_width_with_flags(&text[line_start], line_end - line_start, font,
+                                                             letter_space, flag);
+        line_cnt++;
+        line_start = line_end;
+    }
+
+    lines[line_cnt].start = line_start;
+    lines[line_cnt].width = 0;
+
+    cache->text = text;
+    cache->text_hash = hash;
+    cache->text_len = len;
+    cache->font = font;
+    cache->letter_space = letter_space;
+    cache->max_width = max_width;
+    cache->flag = flag;
+    cache->line_cnt = line_cnt;
+    cache->lines = lines;
+    cache->new_line_at_end = line_start != 0 && (text[line_start - 1] == '\n' || text[line_start - 1] == '\r');
+
+    LV_PROFILER_DRAW_END;
+    return LV_RESULT_OK;
+}
+
+void lv_draw_label_line_cache_get_size(const lv_draw_label_line_cache_t * cache, int32_t line_space,
+                                       lv_point_t * size_res)
+{
+    LV_ASSERT_NULL(cache);
+    LV_ASSERT_NULL(size_res);
+
+    size_res->x = 0;
+    size_res->y = 0;
+    if(cache->lines == NULL) return;
+
+    int32_t letter_height = lv_font_get_line_height(cache->font);
+    uint32_t i;
+    for(i = 0; i < cache->line_cnt; i++) {
+        size_res->x = LV_MAX(size_res->x, cache->lines[i].width);
+    }
+
+    /*Same as `lv_text_get_size`: make the text one line taller if the last character is '\n' or '\r'*/
+    uint32_t line_cnt = cache->line_cnt + (cache->new_line_at_end ? 1 : 0);
+    if(line_cnt == 0) size_res->y = letter_height;
+    else size_res->y = line_cnt * (letter_height + line_space) - line_space;
+}
+
+void lv_draw_label_line_cache_reset(lv_draw_label_line_cache_t * cache)
+{
+    LV_ASSERT_NULL(cache);
+
+    lv_free(cache->lines);
+    lv_memzero(cache, sizeof(lv_draw_label_line_cache_t));
+}
+
 void lv_draw_label_iterate_characters(lv_draw_task_t * t, const lv_draw_label_dsc_t * dsc,
                                       const lv_area_t * coords,
                                       lv_draw_glyph_cb_t cb)
@@ -246,9 +353,27 @@ void lv_draw_label_iterate_characters(lv_draw_task_t * t, const lv_draw_label_ds
 
     uint32_t line_start     = 0;
     int32_t last_line_start = -1;
-
+    uint32_t remaining_len = dsc->text_length;
+    uint32_t line_end;
+
+    /*Use the stored line breaks and line widths if they were calculated for the same text*/
+    const lv_draw_label_line_cache_t * line_cache = get_line_cache(dsc, w);
+    uint32_t line_i = 0;
+    if(line_cache) {
+        if(line_cache->line_cnt == 0) return;
+
+        /*Go the first visible line*/
+        while(pos.y + line_height_font < t->clip_area.y1) {
+            line_i++;
+            pos.y += line_height;
+            if(line_i >= line_cache->line_cnt) return;
+        }
+        line_start = line_cache->lines[line_i].start;
+        line_end = line_cache->lines[line_i + 1].start;
+        line_width = line_cache->lines[line_i].width;
+    }
     /*Check the hint to use the cached info*/
-    if(dsc->hint && y_ofs == 0 && coords->y1 < 0) {
+    else if(dsc->hint && y_ofs == 0 && coords->y1 < 0) {
         /*If the label changed too much recalculate the hint.*/
         if(LV_ABS(dsc->hint->coord_y - coords->y1) > LV_LABEL_HINT_UPDATE_TH - 2 * line_height) {
             dsc->hint->line_start = -1;
@@ -262,13 +387,13 @@ void lv_draw_label_iterate_characters(lv_draw_task_t * t, const lv_draw_label_ds
         pos.y += dsc->hint->y;
     }
 
-    uint32_t remaining_len = dsc->text_length;
-
-    uint32_t line_end = line_start + lv_text_get_next_line(&dsc->text[line_start], remaining_len, font, dsc->letter_space,
-                                                           w, NULL, dsc->flag);
+    if(line_cache == NULL) {
+        line_end = line_start + lv_text_get_next_line(&dsc->text[line_start], remaining_len, font, dsc->letter_space,
+                                                      w, NULL, dsc->flag);
+    }
 
     /*Go the first visible line*/
-    while(pos.y + line_height_font < t->clip_area.y1) {
+    while(line_cache == NULL && pos.y + line_height_font < t->clip_area.y1) {
         /*Go to next line*/
         line_start = line_end;
         line_end += lv_text_get_next_line(&dsc->text[line_start], remaining_len, font, dsc->letter_space, w, NULL, dsc->flag);
@@ -284,18 +409,18 @@ void lv_draw_label_iterate_characters(lv_draw_task_t * t, const lv_draw_label_ds
         if(dsc->text[line_start] == '\0') return;
     }
 
-    /*Align to middle*/
-    if(align == LV_TEXT_ALIGN_CENTER) {
+    if(line_cache == NULL && (align == LV_TEXT_ALIGN_CENTER || align == LV_TEXT_ALIGN_RIGHT)) {
         line_width = lv_text_get_width_with_flags(&dsc->text[line_start], line_end - line_start, font, dsc->letter_space,
                                                   dsc->flag);
+    }
 
+    /*Align to middle*/
+    if(align == LV_TEXT_ALIGN_CENTER) {
         pos.x += (lv_area_get_width(coords) - line_width) / 2;
 
     }
     /*Align to the right*/
     else if(align == LV_TEXT_ALIGN_RIGHT) {
-        line_width = lv_text_get_width_with_flags(&dsc->text[line_start], line_end - line_start, font, dsc->letter_space,
-                                                  dsc->flag);
         pos.x += lv_area_get_width(coords) - line_width;
     }
 
@@ -517,22 +642,27 @@ void lv_draw_label_iterate_characters(lv_draw_task_t * t, const lv_draw_label_ds
         /*Go to next line*/
         remaining_len -= line_end - line_start;
         line_start = line_end;
-        if(remaining_len) {
+        if(line_cache) {
+            line_i++;
+            if(line_i >= line_cache->line_cnt) break;
+            line_end = line_cache->lines[line_i + 1].start;
+            line_width = line_cache->lines[line_i].width;
+        }
+        else if(remaining_len) {
             line_end += lv_text_get_next_line(&dsc->text[line_start], remaining_len, font, dsc->letter_space, w, NULL, dsc->flag);
+            if(align == LV_TEXT_ALIGN_CENTER || align == LV_TEXT_ALIGN_RIGHT) {
+                line_width = lv_text_get_width_with_flags(&dsc->text[line_start], line_end - line_start, font, dsc->letter_space,
+                                                          dsc->flag);
+            }
         }
 
         pos.x = coords->x1;
         /*Align to middle*/
         if(align == LV_TEXT_ALIGN_CENTER) {
-            line_width =
-                lv_text_get_width_with_flags(&dsc->text[line_start], line_end - line_start, font, dsc->letter_space, dsc->flag);
-
             pos.x += (lv_area_get_width(coords) - line_width) / 2;
         }
         /*Align to the right*/
         else if(align == LV_TEXT_ALIGN_RIGHT) {
-            line_width =
-                lv_text_get_width_with_flags(&dsc->text[line_start], line_end - line_start, font, dsc->letter_space, dsc->flag);
             pos.x += lv_area_get_width(coords) - line_width;
         }
 
@@ -563,6 +693,30 @@ static uint8_t hex_char_to_num(char hex)
     return 'A' <= hex && hex <= 'F' ? hex - 'A' + 10 : 0;
 }
 
+/**
+ * Get the line cache of a label draw descriptor if it's up to date
+ * @param dsc   pointer to a label draw descriptor
+ * @param w     the width used to wrap the lines
+ * @return      the line cache or NULL if it can't be used
+ */
+static const lv_draw_label_line_cache_t * get_line_cache(const lv_draw_label_dsc_t * dsc, int32_t w)
+{
+    const lv_draw_label_line_cache_t * cache = dsc->line_cache;
+    if(cache == NULL || cache->lines == NULL) return NULL;
+
+    if(dsc->flag & (LV_TEXT_FLAG_EXPAND | LV_TEXT_FLAG_FIT)) w = LV_COORD_MAX;
+
+    if(cache->text != dsc->text || cache->font != dsc->font || cache->letter_space != dsc->letter_space ||
+       cache->max_width != w || cache->flag != dsc->flag) {
+        return NULL;
+    }
+
+    /*Only a part of the text is drawn*/
+    if(dsc->text_length < cache->text_len) return NULL;
+
+    return cache;
+}
+
 void lv_draw_unit_draw_letter(lv_draw_task_t * t, lv_draw_glyph_dsc_t * dsc,  const lv_point_t * pos,
                               const lv_font_t * font, uint32_t letter, lv_draw_glyph_cb_t cb)
 {
@@ -107,6 +107,10 @@ typedef struct {
     /**Pointer to an externally stored struct where some data can be cached to speed up rendering*/
     lv_draw_label_hint_t * hint;
 
+    /**Pointer to the line breaks of `text` calculated by `lv_draw_label_line_cache_update`.
+     * Used only if it was calculated with the same font, width, letter space and flags.*/
+    const lv_draw_label_line_cache_t * line_cache;
+
     /* Properties of the letter outlines */
     lv_color_t outline_stroke_color;
     int32_t outline_stroke_width;
@@ -41,6 +41,33 @@ struct _lv_draw_label_hint_t {
     int32_t coord_y;
 };
 
+/** Describe a line of a text stored in `lv_draw_label_line_cache_t`*/
+typedef struct {
+    uint32_t start;     /**< Byte index of the first character of the line*/
+    int32_t width;      /**< Width of the line in pixels*/
+} lv_draw_label_line_t;
+
+/** Store the line breaks of a text to not measure it again while it's drawn or
+ * its size is needed with the same font, width, letter space and flags.*/
+struct _lv_draw_label_line_cache_t {
+    const char * text;
+    uint32_t text_hash;
+    uint32_t text_len;
+    const lv_font_t * font;
+    int32_t max_width;
+    int32_t letter_space;
+    lv_text_flag_t flag;
+
+    /** Number of lines*/
+    uint32_t line_cnt;
+
+    /** `line_cnt + 1` lines, the `start` of the last one is `text_len`*/
+    lv_draw_label_line_t * lines;
+
+    /** 1: the text ends with a new line character so there is an empty line at the end*/
+    uint8_t new_line_at_end : 1;
+};
+
 struct _lv_draw_glyph_dsc_t {
     /** Depends on `format` field, it could be image source or draw buf of bitmap or vector data. */
     const void * glyph_data;
@@ -63,6 +90,35 @@ struct _lv_draw_glyph_dsc_t {
  * GLOBAL PROTOTYPES
  **********************/
 
+/**
+ * Calculate the line breaks and the width of the lines of a text.
+ * Nothing is recalculated if the text (compared by its hash) and the parameters are the same as last time.
+ * @param cache         pointer to a line cache, zeroed before the first use
+ * @param text          the text
+ * @param font          the font of the text
+ * @param letter_space  letter space
+ * @param max_width     max width of the lines
+ * @param flag          settings for the text from `lv_text_flag_t`
+ * @return              LV_RESULT_OK: the lines are valid; LV_RESULT_INVALID: out of memory
+ */
+lv_result_t lv_draw_label_line_cache_update(lv_draw_label_line_cache_t * cache, const char * text,
+                                            const lv_font_t * font, int32_t letter_space, int32_t max_width, lv_text_flag_t flag);
+
+/**
+ * Get the size of the text stored in a line cache. Same as `lv_text_get_size` would return.
+ * @param cache         pointer to a line cache updated by `lv_draw_label_line_cache_update`
+ * @param line_space    line space
+ * @param size_res      store the result here
+ */
+void lv_draw_label_line_cache_get_size(const lv_draw_label_line_cache_t * cache, int32_t line_space,
+                                       lv_point_t * size_res);
+
+/**
+ * Free the line breaks stored in a line cache and invalidate it
+ * @param cache         pointer to a line cache
+ */
+void lv_draw_label_line_cache_reset(lv_draw_label_line_cache_t * cache);
+
 /**********************
  *      MACROS
  **********************/
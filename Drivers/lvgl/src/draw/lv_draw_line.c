@@ -11,6 +11,8 @@
 #include "../misc/lv_math.h"
 #include "../misc/lv_types.h"
 #include "../stdlib/lv_string.h"
+#include "../stdlib/lv_mem.h"
+#include "../misc/lv_assert.h"
 
 /*********************
  *      DEFINES
@@ -52,21 +54,62 @@ lv_draw_line_dsc_t * lv_draw_task_get_line_dsc(lv_draw_task_t * task)
 
 void LV_ATTRIBUTE_FAST_MEM lv_draw_line(lv_layer_t * layer, const lv_draw_line_dsc_t * dsc)
 {
-    if(dsc->width == 0) return;
-    if(dsc->opa <= LV_OPA_MIN) return;
+    if(dsc->width == 0 || dsc->opa <= LV_OPA_MIN || (dsc->points && dsc->point_cnt < 2)) {
+        /*No task takes over the points*/
+        if(dsc->points_owned) lv_free((void *)dsc->points);
+        return;
+    }
 
     LV_PROFILER_DRAW_BEGIN;
 
     lv_area_t a;
-    a.x1 = (int32_t)LV_MIN(dsc->p1.x, dsc->p2.x) - dsc->width;
-    a.x2 = (int32_t)LV_MAX(dsc->p1.x, dsc->p2.x) + dsc->width;
-    a.y1 = (int32_t)LV_MIN(dsc->p1.y, dsc->p2.y) - dsc->width;
-    a.y2 = (int32_t)LV_MAX(dsc->p1.y, dsc->p2.y) + dsc->width;
+    if(dsc->points) {
+
+        /*The area of the polyline is the bounding box of all of its points*/
+        a.x1 = (int32_t)dsc->points[0].x;
+        a.x2 = a.x1;
+        a.y1 = (int32_t)dsc->points[0].y;
+        a.y2 = a.y1;
+        uint32_t i;
+        for(i = 1; i < dsc->point_cnt; i++) {
+            a.x1 = LV_MIN(a.x1, (int32_t)dsc->points[i].x);
+            a.x2 = LV_MAX(a.x2, (int32_t)dsc->points[i].x);
+            a.y1 = LV_MIN(a.y1, (int32_t)dsc->points[i].y);
+            a.y2 = LV_MAX(a.y2, (int32_t)dsc->points[i].y);
+        }
+        lv_area_increase(&a, dsc->width, dsc->width);
+    }
+    else {
+        a.x1 = (int32_t)LV_MIN(dsc->p1.x, dsc->p2.x) - dsc->width;
+        a.x2 = (int32_t)LV_MAX(dsc->p1.x, dsc->p2.x) + dsc->width;
+        a.y1 = (int32_t)LV_MIN(dsc->p1.y, dsc->p2.y) - dsc->width;
+        a.y2 = (int32_t)LV_MAX(dsc->p1.y, dsc->p2.y) + dsc->width;
+    }
+
+    /*The points are stored in a local variable so malloc memory for them.
+     *Don't draw anything if it fails, as the task would draw `p1` and `p2` without the points.*/
+    lv_point_precise_t * points_copy = NULL;
+    if(dsc->points && dsc->points_local && !dsc->points_owned) {
+        size_t points_size = dsc->point_cnt * sizeof(lv_point_precise_t);
+        points_copy = lv_malloc(points_size);
+        LV_ASSERT_MALLOC(points_copy);
+        if(points_copy == NULL) {
+            LV_PROFILER_DRAW_END;
+            return;
+        }
+        lv_memcpy(points_copy, dsc->points, points_size);
+    }
 
     lv_draw_task_t * t = lv_draw_add_task(layer, &a, LV_DRAW_TASK_TYPE_LINE);
 
     lv_memcpy(t->draw_dsc, dsc, sizeof(*dsc));
 
+    if(points_copy) {
+        lv_draw_line_dsc_t * new_dsc = t->draw_dsc;
+        new_dsc->points = points_copy;
+        new_dsc->points_owned = 1;
+    }
+
     lv_draw_finalize_task_creation(layer, t);
     LV_PROFILER_DRAW_END;
 }
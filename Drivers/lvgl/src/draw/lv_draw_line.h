@@ -58,6 +58,24 @@ typedef struct {
 
     /**1: Do not bother with line ending (if it's not visible for any reason) */
     uint8_t raw_end     : 1;
+
+    /**1: malloc a buffer and copy `points` there.
+     * 0: `points` will be valid during rendering.*/
+    uint8_t points_local : 1;
+
+    /**1: `points` is allocated with `lv_malloc()` and the draw task takes it over and frees it.
+     * It's freed right away if nothing is drawn. `points_local` is ignored.*/
+    uint8_t points_owned : 1;
+
+    /**If not NULL, draw a polyline connecting `point_cnt` points in one draw task and ignore `p1` and `p2`.
+     * `round_start` and `round_end` apply to the first and last point.
+     * The joints are rounded if `round_end` is set or an opaque line is wider than 2 px.
+     * Where the segments of a semi-transparent line overlap they are blended twice, like separate lines.
+     * Only the software renderer can draw polylines.*/
+    const lv_point_precise_t * points;
+
+    /**Number of points in `points`*/
+    uint32_t point_cnt;
 } lv_draw_line_dsc_t;
 
 /**********************
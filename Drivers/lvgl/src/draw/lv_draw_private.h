@@ -186,6 +186,11 @@ typedef struct {
     volatile int dispatch_req;
 #endif
     lv_mutex_t circle_cache_mutex;
+#if LV_DRAW_LAYER_ARENA_SIZE > 0
+    lv_mutex_t layer_arena_mutex;
+    uint32_t layer_arena_used;      /* bytes allocated from the arena since it was reset */
+    uint32_t layer_arena_cnt;       /* number of layer buffers not released yet */
+#endif
     bool task_running;
 } lv_draw_global_info_t;
 
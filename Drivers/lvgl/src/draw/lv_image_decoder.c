@@ -19,6 +19,7 @@
 #define img_decoder_ll_p &(LV_GLOBAL_DEFAULT()->img_decoder_ll)
 #define img_cache_p (LV_GLOBAL_DEFAULT()->img_cache)
 #define img_header_cache_p (LV_GLOBAL_DEFAULT()->img_header_cache)
+#define img_alpha_cache_p (LV_GLOBAL_DEFAULT()->img_alpha_cache)
 #define image_cache_draw_buf_handlers &(LV_GLOBAL_DEFAULT()->image_cache_draw_buf_handlers)
 
 /**********************
@@ -41,6 +42,10 @@ static lv_image_decoder_t * image_decoder_get_info(lv_image_decoder_dsc_t * dsc,
 
 static lv_result_t try_cache(lv_image_decoder_dsc_t * dsc);
 
+static void alpha_map_attach(lv_image_decoder_dsc_t * dsc);
+
+static bool alpha_map_analyze(const lv_draw_buf_t * decoded, lv_image_alpha_map_t * map);
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -63,6 +68,7 @@ void lv_image_decoder_init(uint32_t image_cache_size, uint32_t image_header_coun
     /*Initialize the cache*/
     lv_image_cache_init(image_cache_size);
     lv_image_header_cache_init(image_header_count);
+    lv_image_alpha_cache_init(LV_IMAGE_ALPHA_CACHE_DEF_CNT);
 }
 
 /**
@@ -72,6 +78,7 @@ void lv_image_decoder_deinit(void)
 {
     lv_cache_destroy(img_cache_p, NULL);
     lv_cache_destroy(img_header_cache_p, NULL);
+    lv_cache_destroy(img_alpha_cache_p, NULL);
 
     lv_ll_clear(img_decoder_ll_p);
 }
@@ -104,7 +111,10 @@ lv_result_t lv_image_decoder_open(lv_image_decoder_dsc_t * dsc, const void * src
             /*
             * Check the cache first
             * If the image is found in the cache, just return it.*/
-            if(try_cache(dsc) == LV_RESULT_OK) return LV_RESULT_OK;
+            if(try_cache(dsc) == LV_RESULT_OK) {
+                alpha_map_attach(dsc);
+                return LV_RESULT_OK;
+            }
         }
     }
 
@@ -142,6 +152,8 @@ lv_result_t lv_image_decoder_open(lv_image_decoder_dsc_t * dsc, const void * src
                         (void *)dsc->decoded->data,
                         dsc->decoded->header.cf);
         }
+
+        alpha_map_attach(dsc);
     }
 
     return res;
@@ -165,6 +177,12 @@ void lv_image_decoder_close(lv_image_decoder_dsc_t * dsc)
             /*Decoded data is in cache, release it from cache's callback*/
             lv_cache_release(dsc->cache, dsc->cache_entry, NULL);
         }
+
+        if(dsc->alpha_cache_entry) {
+            lv_cache_release(img_alpha_cache_p, dsc->alpha_cache_entry, NULL);
+            dsc->alpha_cache_entry = NULL;
+            dsc->alpha_map = NULL;
+        }
     }
 }
 
@@ -415,3 +433,134 @@ static lv_result_t try_cache(lv_image_decoder_dsc_t * dsc)
 
     return LV_RESULT_INVALID;
 }
+
+/**
+ * Find or create the alpha map of the decoded image and save it in `dsc->alpha_map`.
+ * Only full images with constant content can be analyzed as the map is looked up by the source.
+ */
+static void alpha_map_attach(lv_image_decoder_dsc_t * dsc)
+{
+    const lv_draw_buf_t * decoded = dsc->decoded;
+    if(decoded == NULL) return;
+
+    lv_color_format_t cf = decoded->header.cf;
+    if(cf != LV_COLOR_FORMAT_RGB565A8 && cf != LV_COLOR_FORMAT_ARGB8888) return;
+    if(!lv_image_alpha_cache_is_enabled()) return;
+
+    if(dsc->src_type == LV_IMAGE_SRC_VARIABLE) {
+        const lv_image_dsc_t * img_dsc = dsc->src;
+        if(img_dsc->header.flags & LV_IMAGE_FLAGS_MODIFIABLE) return;
+    }
+    else if(dsc->src_type != LV_IMAGE_SRC_FILE) return;
+
+    /*The cached images are always complete, else the decoded area has to cover the whole image*/
+    if(dsc->cache_entry == NULL &&
+       (decoded->header.w != dsc->header.w || decoded->header.h != dsc->header.h)) return;
+
+    lv_image_alpha_cache_data_t search_key;
+    lv_memzero(&search_key, sizeof(search_key));
+    search_key.src_type = dsc->src_type;
+    search_key.src = dsc->src;
+
+    lv_cache_entry_t * entry = lv_cache_acquire(img_alpha_cache_p, &search_key, NULL);
+    if(entry == NULL) {
+        if(alpha_map_analyze(decoded, &search_key.map) == false) return;
+        if(dsc->src_type == LV_IMAGE_SRC_FILE) search_key.src = lv_strdup(dsc->src);
+
+        entry = lv_cache_add(img_alpha_cache_p, &search_key, NULL);
+        if(entry == NULL) {
+            lv_free(search_key.map.tiles);
+            if(dsc->src_type == LV_IMAGE_SRC_FILE) lv_free((void *)search_key.src);
+            return;
+        }
+    }
+
+    lv_image_alpha_cache_data_t * cached_data = lv_cache_entry_get_data(entry);
+    if(cached_data->map.tile_cols != (decoded->header.w + LV_IMAGE_ALPHA_MAP_TILE_SIZE - 1) / LV_IMAGE_ALPHA_MAP_TILE_SIZE ||
+       cached_data->map.tile_rows != (decoded->header.h + LV_IMAGE_ALPHA_MAP_TILE_SIZE - 1) / LV_IMAGE_ALPHA_MAP_TILE_SIZE) {
+        /*The source was changed without invalidating it*/
+        lv_cache_release(img_alpha_cache_p, entry, NULL);
+        return;
+    }
+
+    dsc->alpha_cache_entry = entry;
+    dsc->alpha_map = &cached_data->map;
+}
+
+/**
+ * Mark each tile of an RGB565A8 or ARGB8888 image as fully opaque, fully transparent or mixed.
+ * @param decoded   the decoded image
+ * @param map       store the result here. `map->tiles` needs to be freed by the caller.
+ * @return          true: the map was created; false: out of memory
+ */
+static bool alpha_map_analyze(const lv_draw_buf_t * decoded, lv_image_alpha_map_t * map)
+{
+    const int32_t w = decoded->header.w;
+    const int32_t h = decoded->header.h;
+    const int32_t tile_size = LV_IMAGE_ALPHA_MAP_TILE_SIZE;
+
+    const uint8_t * alpha;
+    int32_t alpha_stride;
+    int32_t alpha_step;
+    if(decoded->header.cf == LV_COLOR_FORMAT_RGB565A8) {
+        /*The alpha map follows the RGB565 map with half of its stride*/
+        alpha = decoded->data + decoded->header.stride * h;
+        alpha_stride = decoded->header.stride / 2;
+        alpha_step = 1;
+    }
+    else {
+        alpha = decoded->data + 3;
+        alpha_stride = decoded->header.stride;
+        alpha_step = 4;
+    }
+
+    map->tile_cols = (w + tile_size - 1) / tile_size;
+    map->tile_rows = (h + tile_size - 1) / tile_size;
+    map->opaque_cnt = 0;
+    map->transp_cnt = 0;
+    map->tiles = lv_malloc((uint32_t)map->tile_cols * map->tile_rows);
+    LV_ASSERT_MALLOC(map->tiles);
+    if(map->tiles == NULL) return false;
+
+    uint8_t * tile = map->tiles;
+    int32_t ty;
+    for(ty = 0; ty < map->tile_rows; ty++) {
+        int32_t y1 = ty * tile_size;
+        int32_t y2 = LV_MIN(y1 + tile_size, h);
+        int32_t tx;
+        for(tx = 0; tx < map->tile_cols; tx++) {
+            int32_t x1 = tx * tile_size;
+            int32_t x2 = LV_MIN(x1 + tile_size, w);
+            uint8_t and_res = 0xff;
+            uint8_t or_res = 0x00;
+            int32_t y;
+            for(y = y1; y < y2; y++) {
+                const uint8_t * a = alpha + y * alpha_stride + x1 * alpha_step;
+                int32_t x;
+                for(x = x1; x < x2; x++) {
+                    and_res &= *a;
+                    or_res |= *a;
+                    a += alpha_step;
+                }
+                /*Mixed for sure, no need to check the other lines*/
+                if(and_res != 0xff && or_res != 0x00) break;
+            }
+
+            if(and_res == 0xff) {
+                *tile = LV_IMAGE_ALPHA_MAP_OPAQUE;
+                map->opaque_cnt++;
+            }
+            else if(or_res == 0x00) {
+                *tile = LV_IMAGE_ALPHA_MAP_TRANSP;
+                map->transp_cnt++;
+            }
+            else {
+                *tile = LV_IMAGE_ALPHA_MAP_MIXED;
+            }
+            tile++;
+        }
+    }
+
+    /*Cache the map even if there are only mixed tiles to not analyze the image again*/
+    return true;
+}
@@ -20,6 +20,9 @@ extern "C" {
  *      DEFINES
  *********************/
 
+/** Width and height of the tiles of `lv_image_alpha_map_t` in pixels*/
+#define LV_IMAGE_ALPHA_MAP_TILE_SIZE    16
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -73,6 +76,29 @@ struct _lv_image_header_cache_data_t {
     lv_image_decoder_t * decoder;
 };
 
+/** Alpha content of an `LV_IMAGE_ALPHA_MAP_TILE_SIZE` x `LV_IMAGE_ALPHA_MAP_TILE_SIZE` tile*/
+typedef enum {
+    LV_IMAGE_ALPHA_MAP_MIXED = 0,
+    LV_IMAGE_ALPHA_MAP_OPAQUE,
+    LV_IMAGE_ALPHA_MAP_TRANSP,
+} lv_image_alpha_map_tile_t;
+
+/** Result of the alpha channel analysis of a decoded image*/
+typedef struct {
+    uint16_t tile_cols;
+    uint16_t tile_rows;
+    uint8_t * tiles;            /**< `lv_image_alpha_map_tile_t` for each tile, row by row*/
+    uint32_t opaque_cnt;        /**< Number of fully opaque tiles*/
+    uint32_t transp_cnt;        /**< Number of fully transparent tiles*/
+} lv_image_alpha_map_t;
+
+struct _lv_image_alpha_cache_data_t {
+    const void * src;
+    lv_image_src_t src_type;
+
+    lv_image_alpha_map_t map;
+};
+
 /**Describe an image decoding session. Stores data about the decoding*/
 struct _lv_image_decoder_dsc_t {
     /**The decoder which was able to open the image source*/
@@ -112,6 +138,12 @@ struct _lv_image_decoder_dsc_t {
     /**Point to cache entry information*/
     lv_cache_entry_t * cache_entry;
 
+    /**Opaque and transparent tiles of `decoded` if its alpha channel was analyzed, else NULL*/
+    const lv_image_alpha_map_t * alpha_map;
+
+    /**The alpha cache entry of `alpha_map`*/
+    lv_cache_entry_t * alpha_cache_entry;
+
     /**Store any custom data here is required*/
     void * user_data;
 };
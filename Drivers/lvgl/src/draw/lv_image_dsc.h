@@ -44,6 +44,8 @@ typedef enum _lvimage_flags_t {
      * The image data is compressed, so decoder needs to decode image firstly.
      * If this flag is set, the whole image will be decompressed upon decode, and
      * `get_area_cb` won't be necessary.
+     * Images compressed in row blocks (`LV_IMAGE_COMPRESS_..._BLOCKS`) are decompressed
+     * block by block via `get_area_cb` instead.
      */
     LV_IMAGE_FLAGS_COMPRESSED       = 0x0008,
 
@@ -82,6 +84,15 @@ typedef enum {
     LV_IMAGE_COMPRESS_NONE = 0,
     LV_IMAGE_COMPRESS_RLE,      /**< LVGL custom RLE compression */
     LV_IMAGE_COMPRESS_LZ4,
+
+    /**
+     * The rows are split into blocks which are compressed independently and found via an index,
+     * so only the blocks intersecting the drawn area are decompressed into a block sized buffer.
+     * Supported only for non-indexed C array images which are not transformed.
+     * See `scripts/image_block_compress.py`.
+     */
+    LV_IMAGE_COMPRESS_RLE_BLOCKS,
+    LV_IMAGE_COMPRESS_LZ4_BLOCKS,
 } lv_image_compress_t;
 
 #if LV_BIG_ENDIAN_SYSTEM
@@ -30,14 +30,54 @@ static void get_rounded_area(int16_t angle, int32_t radius, uint8_t thickness, l
 #define SPLIT_RADIUS_LIMIT 10  /*With radius greater than this the arc will drawn in quarters. A quarter is drawn only if there is arc in it*/
 #define SPLIT_ANGLE_GAP_LIMIT 60  /*With small gaps in the arc don't bother with splitting because there is nothing to skip.*/
 
+#define ARC_SPAN_LINE_MARGIN    3   /*Pixels closer to a side line than this [px] are masked*/
+#define ARC_SPAN_MIN_SKIP       32  /*Skip only the longer holes, a blend call costs more than a few transparent pixels*/
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+#if LV_DRAW_SW_ARC_SPANS
+typedef struct {
+    int32_t x1;
+    int32_t x2;
+} arc_span_t;
+
+typedef struct {
+    int32_t sin;
+    int32_t cos;
+    int64_t slope;              /*cos / sin in 16.16 format*/
+    int64_t margin;             /*Horizontal distance of ARC_SPAN_LINE_MARGIN in 16.16 format*/
+} arc_span_line_t;
+
+typedef struct {
+    void ** mask_list;
+    const lv_draw_sw_mask_radius_param_t * mask_out;
+    const lv_draw_sw_mask_radius_param_t * mask_in;     /*NULL if there is no inner circle*/
+    int32_t center_x;
+    int32_t center_y;
+    arc_span_line_t lines[2];   /*The start and end side lines*/
+    bool wide;                  /*The arc is larger than 180 degrees*/
+    const lv_opa_t * circle_mask;
+    const lv_area_t * round_area[2];
+    int32_t width;
+} arc_span_param_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 
+#if LV_DRAW_SW_ARC_SPANS
+static void blend_row_spans(lv_draw_task_t * t, const arc_span_param_t * p, const lv_draw_sw_blend_dsc_t * blend_dsc,
+                            lv_opa_t * mask_buf, const lv_area_t * row_area);
+static bool get_circle_row(const lv_draw_sw_mask_radius_param_t * param, int32_t y, arc_span_t * cover,
+                           arc_span_t * full);
+static void init_line(arc_span_line_t * line, int32_t angle);
+static void get_line_edge_span(const arc_span_line_t * line, int32_t dy, int32_t center_x, arc_span_t * span);
+static bool is_in_angle_range(const arc_span_param_t * p, int32_t x, int32_t y);
+#endif
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -182,8 +222,38 @@ void lv_draw_sw_arc(lv_draw_task_t * t, const lv_draw_arc_dsc_t * dsc, const lv_
 
     }
 
+#if LV_DRAW_SW_ARC_SPANS
+    /*Without image the hole and the parts out of the angle range can be skipped in the rows*/
+    bool use_spans = blend_dsc.src_buf == NULL;
+    arc_span_param_t span_param;
+    if(use_spans) {
+        span_param.mask_list = mask_list;
+        span_param.mask_out = &mask_out_param;
+        span_param.mask_in = mask_in_param_valid ? &mask_in_param : NULL;
+        span_param.center_x = dsc->center.x;
+        span_param.center_y = dsc->center.y;
+        init_line(&span_param.lines[0], start_angle);
+        init_line(&span_param.lines[1], end_angle);
+        int32_t sweep = end_angle - start_angle;
+        if(sweep < 0) sweep += 360;
+        span_param.wide = sweep > 180;
+        span_param.circle_mask = circle_mask;
+        span_param.round_area[0] = dsc->rounded ? &round_area_1 : NULL;
+        span_param.round_area[1] = dsc->rounded ? &round_area_2 : NULL;
+        span_param.width = width;
+    }
+#endif
+
     blend_area.y2 = blend_area.y1;
     for(h = 0; h < blend_h; h++) {
+#if LV_DRAW_SW_ARC_SPANS
+        if(use_spans) {
+            blend_row_spans(t, &span_param, &blend_dsc, mask_buf, &blend_area);
+            blend_area.y1 ++;
+            blend_area.y2 ++;
+            continue;
+        }
+#endif
         lv_memset(mask_buf, 0xff, blend_w);
         blend_dsc.mask_res = lv_draw_sw_mask_apply(mask_list, mask_buf, blend_area.x1, blend_area.y1, blend_w);
 
@@ -269,6 +339,206 @@ static void add_circle(const lv_opa_t * circle_mask, const lv_area_t * blend_are
 
 }
 
+#if LV_DRAW_SW_ARC_SPANS
+
+/**
+ * Blend a row of the arc. The hole of the ring and the parts out of the angle range are skipped,
+ * and the masks are calculated only for the rest of the row.
+ * @param t             pointer to a draw task
+ * @param p             the geometry of the arc
+ * @param blend_dsc     blend descriptor with the color and opacity set. The areas and the mask are set for each part.
+ * @param mask_buf      buffer for the mask of the row
+ * @param row_area      the clipped area of the row
+ */
+static void blend_row_spans(lv_draw_task_t * t, const arc_span_param_t * p, const lv_draw_sw_blend_dsc_t * blend_dsc,
+                            lv_opa_t * mask_buf, const lv_area_t * row_area)
+{
+    int32_t y = row_area->y1;
+    arc_span_t parts[2];
+    arc_span_t full;
+    uint32_t part_cnt = 1;
+    uint32_t i;
+
+    if(!get_circle_row(p->mask_out, y, &parts[0], &full)) return;
+
+    /*Skip the hole if it's long enough to be worth another blend call*/
+    arc_span_t hole_out;
+    arc_span_t hole;
+    if(p->mask_in && get_circle_row(p->mask_in, y, &hole_out, &hole) &&
+       hole.x2 - hole.x1 + 1 >= ARC_SPAN_MIN_SKIP) {
+        parts[1].x1 = hole.x2 + 1;
+        parts[1].x2 = parts[0].x2;
+        parts[0].x2 = hole.x1 - 1;
+        part_cnt = 2;
+    }
+
+    /*The rounded ends are added to the mask so draw the whole row in one part*/
+    bool round_row = false;
+    for(i = 0; i < 2; i++) {
+        const lv_area_t * round_area = p->round_area[i];
+        if(round_area && y >= round_area->y1 && y <= round_area->y2) {
+            parts[0].x1 = LV_MIN(parts[0].x1, round_area->x1);
+            parts[0].x2 = LV_MAX(parts[part_cnt - 1].x2, round_area->x2);
+            part_cnt = 1;
+            round_row = true;
+        }
+    }
+
+    arc_span_t line_spans[2];
+    get_line_edge_span(&p->lines[0], y - p->center_y, p->center_x, &line_spans[0]);
+    get_line_edge_span(&p->lines[1], y - p->center_y, p->center_x, &line_spans[1]);
+
+    lv_area_t part_area = *row_area;
+    lv_draw_sw_blend_dsc_t part_blend_dsc = *blend_dsc;
+    part_blend_dsc.blend_area = &part_area;
+    part_blend_dsc.mask_area = &part_area;
+
+    for(i = 0; i < part_cnt; i++) {
+        part_area.x1 = LV_MAX(parts[i].x1, row_area->x1);
+        part_area.x2 = LV_MIN(parts[i].x2, row_area->x2);
+        if(part_area.x1 > part_area.x2) continue;
+
+        /*If the part doesn't reach the side lines it's either fully in or fully out of the angle range*/
+        if(!round_row &&
+           (line_spans[0].x1 > part_area.x2 || line_spans[0].x2 < part_area.x1) &&
+           (line_spans[1].x1 > part_area.x2 || line_spans[1].x2 < part_area.x1) &&
+           !is_in_angle_range(p, part_area.x1, y)) {
+            continue;
+        }
+
+        int32_t part_w = lv_area_get_width(&part_area);
+        lv_opa_t * part_mask_buf = mask_buf + part_area.x1 - row_area->x1;
+        lv_memset(part_mask_buf, 0xff, part_w);
+        part_blend_dsc.mask_res = lv_draw_sw_mask_apply(p->mask_list, part_mask_buf, part_area.x1, y, part_w);
+
+        if(round_row) {
+            if(part_blend_dsc.mask_res == LV_DRAW_SW_MASK_RES_TRANSP) lv_memzero(part_mask_buf, part_w);
+            uint32_t r;
+            for(r = 0; r < 2; r++) {
+                const lv_area_t * round_area = p->round_area[r];
+                if(round_area && y >= round_area->y1 && y <= round_area->y2) {
+                    add_circle(p->circle_mask, row_area, round_area, mask_buf, p->width);
+                }
+            }
+            part_blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
+        }
+
+        if(part_blend_dsc.mask_res == LV_DRAW_SW_MASK_RES_TRANSP) continue;
+
+        part_blend_dsc.mask_buf = part_mask_buf;
+        lv_draw_sw_blend(t, &part_blend_dsc);
+    }
+}
+
+/**
+ * Get the pixels of a row which can be covered by a circle drawn by a radius mask.
+ * Uses the anti-aliasing data of the circle cache instead of calculating the edges.
+ * @param param     an initialized radius mask of a circle
+ * @param y         the Y coordinate of the row
+ * @param cover     store the pixels which are not fully out of the circle here
+ * @param full      store the pixels which are fully in the circle here
+ * @return          false: the row is out of the circle
+ */
+static bool get_circle_row(const lv_draw_sw_mask_radius_param_t * param, int32_t y, arc_span_t * cover,
+                           arc_span_t * full)
+{
+    const lv_area_t * rect = &param->cfg.rect;
+    if(y < rect->y1 || y > rect->y2) return false;
+
+    int32_t radius = param->cfg.radius;
+    if(param->circle == NULL || (y >= rect->y1 + radius && y <= rect->y2 - radius)) {
+        cover->x1 = rect->x1;
+        cover->x2 = rect->x2;
+        *full = *cover;
+        return true;
+    }
+
+    int32_t cir_y;
+    if(y - rect->y1 < radius) cir_y = radius - (y - rect->y1) - 1;
+    else cir_y = y - rect->y1 - (lv_area_get_height(rect) - radius);
+
+    const lv_draw_sw_mask_radius_circle_dsc_t * c = param->circle;
+    int32_t aa_len = c->opa_start_on_y[cir_y + 1] - c->opa_start_on_y[cir_y];
+    int32_t x_start = c->x_start_on_y[cir_y];
+
+    /*The same as in the radius mask*/
+    int32_t cir_x_right = rect->x1 + lv_area_get_width(rect) - radius + x_start;
+    int32_t cir_x_left = rect->x1 + radius - x_start - 1;
+
+    cover->x1 = cir_x_left - aa_len + 1;
+    cover->x2 = cir_x_right + aa_len - 1;
+    full->x1 = cir_x_left + 1;
+    full->x2 = cir_x_right - 1;
+    return true;
+}
+
+/**
+ * Prepare a side line of the arc to get its pixels in the rows
+ * @param line      store the line here
+ * @param angle     the angle of the line
+ */
+static void init_line(arc_span_line_t * line, int32_t angle)
+{
+    line->sin = lv_trigo_sin(angle);
+    line->cos = lv_trigo_cos(angle);
+    if(line->sin == 0) {
+        line->slope = 0;
+        line->margin = 0;
+    }
+    else {
+        /*x = y * cos / sin and the horizontal distance of the margin is margin / |sin|*/
+        line->slope = ((int64_t)line->cos << 16) / line->sin;
+        line->margin = ((int64_t)ARC_SPAN_LINE_MARGIN << (16 + LV_TRIGO_SHIFT)) / LV_ABS(line->sin) + (1 << 16);
+    }
+}
+
+/**
+ * Get the pixels of a row which are close to a side line
+ * @param line      the side line
+ * @param dy        distance of the row from the center
+ * @param center_x  X coordinate of the center
+ * @param span      store the pixels here
+ */
+static void get_line_edge_span(const arc_span_line_t * line, int32_t dy, int32_t center_x, arc_span_t * span)
+{
+    if(line->sin == 0) {
+        /*Horizontal line: the whole row or nothing*/
+        if(LV_ABS(dy) < ARC_SPAN_LINE_MARGIN) {
+            span->x1 = LV_COORD_MIN;
+            span->x2 = LV_COORD_MAX;
+        }
+        else {
+            span->x1 = LV_COORD_MAX;
+            span->x2 = LV_COORD_MIN;
+        }
+        return;
+    }
+
+    int64_t x = (int64_t)center_x * 65536 + dy * line->slope;
+    span->x1 = (int32_t)LV_CLAMP(LV_COORD_MIN, (x - line->margin) >> 16, LV_COORD_MAX);
+    span->x2 = (int32_t)LV_CLAMP(LV_COORD_MIN, (x + line->margin) >> 16, LV_COORD_MAX);
+}
+
+/**
+ * Tell whether a pixel is in the angle range of the arc. Works only with pixels which are not close to the side lines.
+ * @param p     the geometry of the arc
+ * @param x     X coordinate of the pixel
+ * @param y     Y coordinate of the pixel
+ * @return      true: the pixel is in the angle range
+ */
+static bool is_in_angle_range(const arc_span_param_t * p, int32_t x, int32_t y)
+{
+    int64_t dx = x - p->center_x;
+    int64_t dy = y - p->center_y;
+    bool after_start = p->lines[0].cos * dy - p->lines[0].sin * dx >= 0;
+    bool before_end = p->lines[1].sin * dx - p->lines[1].cos * dy >= 0;
+
+    if(p->wide) return after_start || before_end;
+    else return after_start && before_end;
+}
+
+#endif /*LV_DRAW_SW_ARC_SPANS*/
+
 static void get_rounded_area(int16_t angle, int32_t radius, uint8_t thickness, lv_area_t * res_area)
 {
     int32_t thick_half = thickness / 2;
@@ -42,6 +42,11 @@
 static void /* LV_ATTRIBUTE_FAST_MEM */ shadow_draw_corner_buf(const lv_area_t * coords, uint16_t * sh_buf, int32_t s,
                                                                int32_t r);
 static void /* LV_ATTRIBUTE_FAST_MEM */ shadow_blur_corner(int32_t size, int32_t sw, uint16_t * sh_ups_buf);
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+    static lv_opa_t * shadow_cache_get(int32_t sw, int32_t r, int32_t core_w, int32_t core_h, int32_t corner_size);
+    static void shadow_cache_add(const lv_opa_t * sh_buf, int32_t sw, int32_t r, int32_t core_w, int32_t core_h,
+                                 int32_t corner_size);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -55,6 +60,24 @@ static void /* LV_ATTRIBUTE_FAST_MEM */ shadow_blur_corner(int32_t size, int32_t
  *   GLOBAL FUNCTIONS
  **********************/
 
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+void lv_draw_sw_shadow_cache_init(void)
+{
+    lv_mutex_init(&shadow_cache.mutex);
+}
+
+void lv_draw_sw_shadow_cache_deinit(void)
+{
+    uint32_t i;
+    for(i = 0; i < LV_DRAW_SW_SHADOW_CACHE_ENTRY_CNT; i++) {
+        lv_free(shadow_cache.entries[i].buf);
+        shadow_cache.entries[i].buf = NULL;
+    }
+    shadow_cache.used_memory = 0;
+    lv_mutex_delete(&shadow_cache.mutex);
+}
+#endif
+
 void lv_draw_sw_box_shadow(lv_draw_task_t * t, const lv_draw_box_shadow_dsc_t * dsc, const lv_area_t * coords)
 {
     /*Calculate the rectangle which is blurred to get the shadow in `shadow_area`*/
@@ -100,25 +123,18 @@ void lv_draw_sw_box_shadow(lv_draw_task_t * t, const lv_draw_box_shadow_dsc_t *
     lv_opa_t * sh_buf;
 
 #if LV_DRAW_SW_SHADOW_CACHE_SIZE
-    lv_draw_sw_shadow_cache_t * cache = &shadow_cache;
-    if(cache->cache_size == corner_size && cache->cache_r == r_sh) {
-        /*Use the cache if available*/
-        sh_buf = lv_malloc(corner_size * corner_size);
-        LV_ASSERT_MALLOC(sh_buf);
-        lv_memcpy(sh_buf, cache->cache, corner_size * corner_size);
-    }
-    else {
+    /*The size of the blurred rectangle matters only if it's so small that its other corners affect this corner too*/
+    int32_t core_w = LV_MIN(lv_area_get_width(&core_area), 2 * corner_size);
+    int32_t core_h = LV_MIN(lv_area_get_height(&core_area), 2 * corner_size);
+
+    /*Use the cache if available*/
+    sh_buf = shadow_cache_get(dsc->width, r_sh, core_w, core_h, corner_size);
+    if(sh_buf == NULL) {
         /*A larger buffer is required for calculation*/
         sh_buf = lv_malloc(corner_size * corner_size * sizeof(uint16_t));
         LV_ASSERT_MALLOC(sh_buf);
         shadow_draw_corner_buf(&core_area, (uint16_t *)sh_buf, dsc->width, r_sh);
-
-        /*Cache the corner if it fits into the cache size*/
-        if((uint32_t)corner_size * corner_size < sizeof(cache->cache)) {
-            lv_memcpy(cache->cache, sh_buf, corner_size * corner_size);
-            cache->cache_size = corner_size;
-            cache->cache_r = r_sh;
-        }
+        shadow_cache_add(sh_buf, dsc->width, r_sh, core_w, core_h, corner_size);
     }
 #else
     sh_buf = lv_malloc(corner_size * corner_size * sizeof(uint16_t));
@@ -657,6 +673,99 @@ static void LV_ATTRIBUTE_FAST_MEM shadow_draw_corner_buf(const lv_area_t * coord
 
 }
 
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+
+/**
+ * Get a copy of a cached shadow corner
+ * @param sw            shadow width
+ * @param r             clamped shadow radius
+ * @param core_w        width of the blurred rectangle clamped to `2 * corner_size`
+ * @param core_h        height of the blurred rectangle clamped to `2 * corner_size`
+ * @param corner_size   `sw + r`
+ * @return              a `corner_size * corner_size` sized buffer allocated by `lv_malloc`
+ *                      or NULL if the corner is not cached
+ */
+static lv_opa_t * shadow_cache_get(int32_t sw, int32_t r, int32_t core_w, int32_t core_h, int32_t corner_size)
+{
+    lv_draw_sw_shadow_cache_t * cache = &shadow_cache;
+    lv_opa_t * sh_buf = NULL;
+
+    lv_mutex_lock(&cache->mutex);
+    uint32_t i;
+    for(i = 0; i < LV_DRAW_SW_SHADOW_CACHE_ENTRY_CNT; i++) {
+        lv_draw_sw_shadow_cache_entry_t * entry = &cache->entries[i];
+        if(entry->buf && entry->width == sw && entry->radius == r &&
+           entry->core_w == core_w && entry->core_h == core_h) {
+            sh_buf = lv_malloc(corner_size * corner_size);
+            LV_ASSERT_MALLOC(sh_buf);
+            if(sh_buf) {
+                lv_memcpy(sh_buf, entry->buf, corner_size * corner_size);
+                cache->life_cnt++;
+                entry->life = cache->life_cnt;
+            }
+            break;
+        }
+    }
+    lv_mutex_unlock(&cache->mutex);
+
+    return sh_buf;
+}
+
+/**
+ * Save a shadow corner in the cache, dropping the least recently used corners
+ * if there is no free entry or `LV_DRAW_SW_SHADOW_CACHE_MEMORY` would be exceeded.
+ * @param sh_buf        the calculated corner
+ * @param sw            shadow width
+ * @param r             clamped shadow radius
+ * @param core_w        width of the blurred rectangle clamped to `2 * corner_size`
+ * @param core_h        height of the blurred rectangle clamped to `2 * corner_size`
+ * @param corner_size   `sw + r`
+ */
+static void shadow_cache_add(const lv_opa_t * sh_buf, int32_t sw, int32_t r, int32_t core_w, int32_t core_h,
+                             int32_t corner_size)
+{
+    uint32_t size = (uint32_t)corner_size * corner_size;
+    if(corner_size > LV_DRAW_SW_SHADOW_CACHE_SIZE || size > LV_DRAW_SW_SHADOW_CACHE_MEMORY) return;
+
+    lv_draw_sw_shadow_cache_t * cache = &shadow_cache;
+    lv_mutex_lock(&cache->mutex);
+
+    lv_draw_sw_shadow_cache_entry_t * free_entry;
+    while(1) {
+        free_entry = NULL;
+        lv_draw_sw_shadow_cache_entry_t * oldest = NULL;
+        uint32_t i;
+        for(i = 0; i < LV_DRAW_SW_SHADOW_CACHE_ENTRY_CNT; i++) {
+            lv_draw_sw_shadow_cache_entry_t * entry = &cache->entries[i];
+            if(entry->buf == NULL) free_entry = entry;
+            else if(oldest == NULL || cache->life_cnt - entry->life > cache->life_cnt - oldest->life) oldest = entry;
+        }
+
+        if(free_entry && cache->used_memory + size <= LV_DRAW_SW_SHADOW_CACHE_MEMORY) break;
+
+        /*Drop the least recently used corner*/
+        cache->used_memory -= (uint32_t)(oldest->width + oldest->radius) * (oldest->width + oldest->radius);
+        lv_free(oldest->buf);
+        oldest->buf = NULL;
+    }
+
+    free_entry->buf = lv_malloc(size);
+    if(free_entry->buf) {
+        lv_memcpy(free_entry->buf, sh_buf, size);
+        free_entry->width = sw;
+        free_entry->radius = r;
+        free_entry->core_w = core_w;
+        free_entry->core_h = core_h;
+        cache->life_cnt++;
+        free_entry->life = cache->life_cnt;
+        cache->used_memory += size;
+    }
+
+    lv_mutex_unlock(&cache->mutex);
+}
+
+#endif /*LV_DRAW_SW_SHADOW_CACHE_SIZE*/
+
 static void LV_ATTRIBUTE_FAST_MEM shadow_blur_corner(int32_t size, int32_t sw, uint16_t * sh_ups_buf)
 {
     int32_t s_left = sw >> 1;
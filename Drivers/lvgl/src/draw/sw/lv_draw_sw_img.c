@@ -88,6 +88,12 @@ static void recolor(lv_area_t relative_area, uint8_t * src_buf, uint8_t * dest_b
 
 static bool apply_mask(const lv_draw_image_dsc_t * draw_dsc);
 
+static bool alpha_map_usable(const lv_image_decoder_dsc_t * decoder_dsc, const lv_draw_image_dsc_t * draw_dsc,
+                             const lv_area_t * img_coords);
+
+static void blend_alpha_map(lv_draw_task_t * t, const lv_draw_sw_blend_dsc_t * blend_dsc,
+                            const lv_image_alpha_map_t * map, lv_color_format_t opaque_cf);
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -265,7 +271,12 @@ static void img_draw_core(lv_draw_task_t * t, const lv_draw_image_dsc_t * draw_d
         blend_dsc.mask_area = img_coords;
         blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
         blend_dsc.src_color_format = LV_COLOR_FORMAT_RGB565;
-        lv_draw_sw_blend(t, &blend_dsc);
+        if(alpha_map_usable(decoder_dsc, draw_dsc, img_coords)) {
+            blend_alpha_map(t, &blend_dsc, decoder_dsc->alpha_map, LV_COLOR_FORMAT_RGB565);
+        }
+        else {
+            lv_draw_sw_blend(t, &blend_dsc);
+        }
     }
     else if(!transformed && !radius && (cf == LV_COLOR_FORMAT_L8 || cf == LV_COLOR_FORMAT_AL88)) {
         blend_dsc.src_area = img_coords;
@@ -280,7 +291,12 @@ static void img_draw_core(lv_draw_task_t * t, const lv_draw_image_dsc_t * draw_d
         blend_dsc.src_buf = src_buf;
         blend_dsc.blend_area = img_coords;
         blend_dsc.src_color_format = cf;
-        lv_draw_sw_blend(t, &blend_dsc);
+        if(cf == LV_COLOR_FORMAT_ARGB8888 && alpha_map_usable(decoder_dsc, draw_dsc, img_coords)) {
+            blend_alpha_map(t, &blend_dsc, decoder_dsc->alpha_map, LV_COLOR_FORMAT_XRGB8888);
+        }
+        else {
+            lv_draw_sw_blend(t, &blend_dsc);
+        }
     }
     else if(!transformed && !radius && draw_dsc->recolor_opa > LV_OPA_MIN) {
         recolor_only(t, draw_dsc, decoder_dsc, img_coords,  clipped_img_area);
@@ -830,4 +846,91 @@ static bool apply_mask(const lv_draw_image_dsc_t * draw_dsc)
     return true;
 }
 
+
+static bool alpha_map_usable(const lv_image_decoder_dsc_t * decoder_dsc, const lv_draw_image_dsc_t * draw_dsc,
+                             const lv_area_t * img_coords)
+{
+    if(decoder_dsc->alpha_map == NULL) return false;
+
+    /*Other blend modes might change the pixels even where the image is transparent*/
+    if(draw_dsc->blend_mode != LV_BLEND_MODE_NORMAL) return false;
+
+    /*The map needs to describe exactly the drawn pixels*/
+    const lv_image_header_t * header = &decoder_dsc->decoded->header;
+    return lv_area_get_width(img_coords) == header->w && lv_area_get_height(img_coords) == header->h;
+}
+
+/**
+ * Blend an image with alpha channel tile row by tile row using its alpha map.
+ * Consecutive tiles with the same alpha content are blended together. Transparent tiles are skipped,
+ * opaque tiles are blended as `opaque_cf` without checking the alpha channel and
+ * mixed tiles are blended as described in `blend_dsc`.
+ * @param t             pointer to a draw task
+ * @param blend_dsc     blend descriptor of the whole image
+ * @param map           alpha map of the image
+ * @param opaque_cf     color format of the image without its alpha channel
+ */
+static void blend_alpha_map(lv_draw_task_t * t, const lv_draw_sw_blend_dsc_t * blend_dsc,
+                            const lv_image_alpha_map_t * map, lv_color_format_t opaque_cf)
+{
+    const lv_area_t * img_coords = blend_dsc->src_area;
+    const int32_t tile_size = LV_IMAGE_ALPHA_MAP_TILE_SIZE;
+
+    lv_area_t clipped;
+    if(!lv_area_intersect(&clipped, img_coords, &t->clip_area)) return;
+
+    /*Mixing the color with `opa` differs from mixing with `opa` and 255 alpha, so opaque tiles
+     *can be copied only if the image is not faded*/
+    bool copy_opaque = blend_dsc->opa >= LV_OPA_MAX;
+
+    lv_draw_sw_blend_dsc_t opaque_dsc = *blend_dsc;
+    opaque_dsc.mask_buf = NULL;
+    opaque_dsc.mask_area = NULL;
+    opaque_dsc.mask_res = LV_DRAW_SW_MASK_RES_FULL_COVER;
+    opaque_dsc.src_color_format = opaque_cf;
+
+    lv_draw_sw_blend_dsc_t mixed_dsc = *blend_dsc;
+
+    int32_t tx_first = (clipped.x1 - img_coords->x1) / tile_size;
+    int32_t tx_last = (clipped.x2 - img_coords->x1) / tile_size;
+    int32_t ty_first = (clipped.y1 - img_coords->y1) / tile_size;
+    int32_t ty_last = (clipped.y2 - img_coords->y1) / tile_size;
+
+    int32_t ty;
+    for(ty = ty_first; ty <= ty_last; ty++) {
+        const uint8_t * tiles = &map->tiles[ty * map->tile_cols];
+        lv_area_t run;
+        run.y1 = LV_MAX(img_coords->y1 + ty * tile_size, clipped.y1);
+        run.y2 = LV_MIN(img_coords->y1 + (ty + 1) * tile_size - 1, clipped.y2);
+
+        int32_t tx = tx_first;
+        while(tx <= tx_last) {
+            uint8_t type = tiles[tx];
+            if(type == LV_IMAGE_ALPHA_MAP_OPAQUE && !copy_opaque) type = LV_IMAGE_ALPHA_MAP_MIXED;
+
+            int32_t tx_end = tx;
+            while(tx_end < tx_last) {
+                uint8_t next_type = tiles[tx_end + 1];
+                if(next_type == LV_IMAGE_ALPHA_MAP_OPAQUE && !copy_opaque) next_type = LV_IMAGE_ALPHA_MAP_MIXED;
+                if(next_type != type) break;
+                tx_end++;
+            }
+
+            run.x1 = LV_MAX(img_coords->x1 + tx * tile_size, clipped.x1);
+            run.x2 = LV_MIN(img_coords->x1 + (tx_end + 1) * tile_size - 1, clipped.x2);
+
+            if(type == LV_IMAGE_ALPHA_MAP_OPAQUE) {
+                opaque_dsc.blend_area = &run;
+                lv_draw_sw_blend(t, &opaque_dsc);
+            }
+            else if(type == LV_IMAGE_ALPHA_MAP_MIXED) {
+                mixed_dsc.blend_area = &run;
+                lv_draw_sw_blend(t, &mixed_dsc);
+            }
+
+            tx = tx_end + 1;
+        }
+    }
+}
+
 #endif /*LV_USE_DRAW_SW*/
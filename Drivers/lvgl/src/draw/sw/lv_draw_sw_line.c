@@ -31,6 +31,8 @@
  *  STATIC PROTOTYPES
  **********************/
 
+static void draw_segment(lv_draw_task_t * t, const lv_draw_line_dsc_t * dsc);
+static void draw_polyline(lv_draw_task_t * t, const lv_draw_line_dsc_t * dsc);
 static void /* LV_ATTRIBUTE_FAST_MEM */ draw_line_skew(lv_draw_task_t * t, const lv_draw_line_dsc_t * dsc);
 static void /* LV_ATTRIBUTE_FAST_MEM */ draw_line_hor(lv_draw_task_t * t, const lv_draw_line_dsc_t * dsc);
 static void /* LV_ATTRIBUTE_FAST_MEM */ draw_line_ver(lv_draw_task_t * t, const lv_draw_line_dsc_t * dsc);
@@ -52,6 +54,16 @@ void lv_draw_sw_line(lv_draw_task_t * t, const lv_draw_line_dsc_t * dsc)
     if(dsc->width == 0) return;
     if(dsc->opa <= LV_OPA_MIN) return;
 
+    if(dsc->points) draw_polyline(t, dsc);
+    else draw_segment(t, dsc);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void draw_segment(lv_draw_task_t * t, const lv_draw_line_dsc_t * dsc)
+{
     if(dsc->p1.x == dsc->p2.x && dsc->p1.y == dsc->p2.y) return;
 
     lv_area_t clip_line;
@@ -99,9 +111,65 @@ void lv_draw_sw_line(lv_draw_task_t * t, const lv_draw_line_dsc_t * dsc)
     LV_PROFILER_DRAW_END;
 }
 
-/**********************
- *   STATIC FUNCTIONS
- **********************/
+/**
+ * Draw the segments of a polyline which are in the clip area.
+ * The joints of wide lines are rounded to fill the gaps between the perpendicular ends of the segments.
+ * The joints of lines with rounded end are always rounded, as if the segments were drawn one by one.
+ * @param t         pointer to a draw task
+ * @param dsc       the line draw descriptor with `points`
+ */
+static void draw_polyline(lv_draw_task_t * t, const lv_draw_line_dsc_t * dsc)
+{
+    if(dsc->point_cnt < 2) return;
+
+    LV_PROFILER_DRAW_BEGIN;
+    const lv_area_t * clip = &t->clip_area;
+    int32_t w_half = dsc->width / 2;
+    /*Filling the joints of semi-transparent lines would blend the joints once more, so do it only for opaque lines*/
+    bool round_joints = dsc->round_end || (dsc->width > 2 && dsc->opa >= LV_OPA_MAX && !dsc->raw_end &&
+                                           !(dsc->dash_gap && dsc->dash_width));
+
+    lv_draw_line_dsc_t seg_dsc = *dsc;
+    seg_dsc.points = NULL;
+
+    lv_draw_fill_dsc_t cir_dsc;
+    lv_draw_fill_dsc_init(&cir_dsc);
+    cir_dsc.color = dsc->color;
+    cir_dsc.radius = LV_RADIUS_CIRCLE;
+    cir_dsc.opa = dsc->opa;
+    int32_t r_corr = (dsc->width & 1) ? 0 : 1;
+
+    uint32_t last = dsc->point_cnt - 1;
+    uint32_t i;
+    for(i = 0; i < last; i++) {
+        const lv_point_precise_t * p1 = &dsc->points[i];
+        const lv_point_precise_t * p2 = &dsc->points[i + 1];
+        if(p1->x == p2->x && p1->y == p2->y) continue;
+
+        /*Skip the segments out of the clip area before preparing them*/
+        if((int32_t)LV_MAX(p1->y, p2->y) + w_half < clip->y1) continue;
+        if((int32_t)LV_MIN(p1->y, p2->y) - w_half > clip->y2) continue;
+        if((int32_t)LV_MAX(p1->x, p2->x) + w_half < clip->x1) continue;
+        if((int32_t)LV_MIN(p1->x, p2->x) - w_half > clip->x2) continue;
+
+        seg_dsc.p1 = *p1;
+        seg_dsc.p2 = *p2;
+        seg_dsc.round_start = i == 0 ? dsc->round_start : 0;
+        seg_dsc.round_end = i + 1 == last ? dsc->round_end : 0;
+        draw_segment(t, &seg_dsc);
+
+        if(round_joints && i + 1 < last) {
+            lv_area_t cir_area;
+            cir_area.x1 = (int32_t)p2->x - w_half;
+            cir_area.y1 = (int32_t)p2->y - w_half;
+            cir_area.x2 = (int32_t)p2->x + w_half - r_corr;
+            cir_area.y2 = (int32_t)p2->y + w_half - r_corr;
+            if(lv_area_is_on(&cir_area, clip)) lv_draw_sw_fill(t, &cir_dsc, &cir_area);
+        }
+    }
+    LV_PROFILER_DRAW_END;
+}
+
 static void LV_ATTRIBUTE_FAST_MEM draw_line_hor(lv_draw_task_t * t, const lv_draw_line_dsc_t * dsc)
 {
     int32_t w = dsc->width - 1;
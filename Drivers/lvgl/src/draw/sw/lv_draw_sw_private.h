@@ -23,6 +23,9 @@ extern "C" {
  *      DEFINES
  *********************/
 
+/** Max number of shadow corners in the shadow cache */
+#define LV_DRAW_SW_SHADOW_CACHE_ENTRY_CNT   16
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -52,9 +55,19 @@ struct _lv_draw_sw_unit_t {
 
 #if LV_DRAW_SW_SHADOW_CACHE_SIZE
 typedef struct {
-    uint8_t cache[LV_DRAW_SW_SHADOW_CACHE_SIZE * LV_DRAW_SW_SHADOW_CACHE_SIZE];
-    int32_t cache_size;
-    int32_t cache_r;
+    lv_opa_t * buf;     /**< The blurred corner, NULL if the entry is free*/
+    uint32_t life;      /**< Value of the cache's `life_cnt` when the entry was last used*/
+    int32_t width;      /**< Shadow width*/
+    int32_t radius;     /**< Clamped shadow radius*/
+    int32_t core_w;     /**< Width of the blurred rectangle clamped to the size which can affect the corner*/
+    int32_t core_h;     /**< Height of the blurred rectangle clamped to the size which can affect the corner*/
+} lv_draw_sw_shadow_cache_entry_t;
+
+typedef struct {
+    lv_draw_sw_shadow_cache_entry_t entries[LV_DRAW_SW_SHADOW_CACHE_ENTRY_CNT];
+    uint32_t used_memory;   /**< Size of the cached corners in bytes*/
+    uint32_t life_cnt;
+    lv_mutex_t mutex;
 } lv_draw_sw_shadow_cache_t;
 #endif
 
@@ -62,6 +75,18 @@ typedef struct {
  * GLOBAL PROTOTYPES
  **********************/
 
+#if LV_DRAW_SW_COMPLEX && LV_DRAW_SW_SHADOW_CACHE_SIZE
+/**
+ * Initialize the cache of the blurred shadow corners
+ */
+void lv_draw_sw_shadow_cache_init(void);
+
+/**
+ * Free the cached shadow corners
+ */
+void lv_draw_sw_shadow_cache_deinit(void);
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -75,6 +75,12 @@ static void transform_rgb565a8(const uint8_t * src, int32_t src_w, int32_t src_h
                                int32_t x_end, uint16_t * cbuf, uint8_t * abuf, bool src_has_a8, bool aa);
 #endif
 
+#if LV_DRAW_SW_TRANSFORM_FAST_RGB565 && LV_DRAW_SW_SUPPORT_RGB565A8
+static void transform_rgb565a8_dda(const lv_area_t * dest_area, const uint8_t * src, int32_t src_w, int32_t src_h,
+                                   int32_t src_stride, const lv_draw_image_dsc_t * draw_dsc,
+                                   uint16_t * cbuf, uint8_t * abuf, bool src_has_a8);
+#endif
+
 #if LV_DRAW_SW_SUPPORT_RGB565_SWAPPED
 static void transform_rgb565a8_swapped(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
                                        int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
@@ -173,6 +179,21 @@ void lv_draw_sw_transform(const lv_area_t * dest_area, const void * src_buf,
     LV_UNUSED(xs_step_256);
     LV_UNUSED(ys_step_256);
 
+#if LV_DRAW_SW_TRANSFORM_FAST_RGB565 && LV_DRAW_SW_SUPPORT_RGB565A8
+    if(is_rotated) {
+#if LV_DRAW_SW_SUPPORT_RGB565
+        if(src_cf == LV_COLOR_FORMAT_RGB565) {
+            transform_rgb565a8_dda(dest_area, src_buf, src_w, src_h, src_stride, draw_dsc, dest_buf, alpha_buf, false);
+            return;
+        }
+#endif
+        if(src_cf == LV_COLOR_FORMAT_RGB565A8) {
+            transform_rgb565a8_dda(dest_area, src_buf, src_w, src_h, src_stride, draw_dsc, dest_buf, alpha_buf, true);
+            return;
+        }
+    }
+#endif
+
     /*If scaled only make some simplification to avoid rounding errors.
      *For example if there is a 100x100 image zoomed to 300%
      *The destination area in X will be x1=0; x2=299
@@ -750,6 +771,222 @@ static void transform_rgb565a8(const uint8_t * src, int32_t src_w, int32_t src_h
 
 #endif
 
+#if LV_DRAW_SW_TRANSFORM_FAST_RGB565 && LV_DRAW_SW_SUPPORT_RGB565A8
+
+static int64_t div_floor(int64_t n, int64_t d)
+{
+    int64_t q = n / d;
+    if((n % d != 0) && ((n < 0) != (d < 0))) q--;
+    return q;
+}
+
+/**
+ * Limit a span of destination pixels to the pixels where a linearly changing source coordinate is in a range.
+ * @param f0        the source coordinate at x = 0
+ * @param df        change of the source coordinate for every x
+ * @param lo        the smallest allowed source coordinate
+ * @param hi        the first not allowed source coordinate above `lo`
+ * @param x1        the first pixel of the span. Will be increased if required
+ * @param x2        the pixel after the last pixel of the span. Will be decreased if required
+ */
+static void span_clip(int64_t f0, int32_t df, int64_t lo, int64_t hi, int32_t * x1, int32_t * x2)
+{
+    int64_t a;
+    int64_t b;
+    if(df == 0) {
+        if(f0 >= lo && f0 < hi) return;
+        a = *x2;
+        b = *x2;
+    }
+    else if(df > 0) {
+        a = -div_floor(f0 - lo, df);
+        b = -div_floor(f0 - hi, df);
+    }
+    else {
+        a = div_floor(f0 - hi, -df) + 1;
+        b = div_floor(f0 - lo, -df) + 1;
+    }
+
+    if(a > *x1) *x1 = a > *x2 ? *x2 : (int32_t)a;
+    if(b < *x2) *x2 = b < *x1 ? *x1 : (int32_t)b;
+}
+
+/**
+ * Mix 4 neighboring RGB565 pixels.
+ * @param c00       top left pixel
+ * @param c10       top right pixel
+ * @param c01       bottom left pixel
+ * @param c11       bottom right pixel
+ * @param fx        horizontal weight of the right pixels [0..31]
+ * @param fy        vertical weight of the bottom pixels [0..31]
+ * @return          the mixed color
+ */
+static inline uint16_t rgb565_bilinear(uint16_t c00, uint16_t c10, uint16_t c01, uint16_t c11,
+                                       uint32_t fx, uint32_t fy)
+{
+    /*Spread the channels to have room for the multiplication (see lv_color_16_16_mix())*/
+    uint32_t e00 = ((uint32_t)c00 | ((uint32_t)c00 << 16)) & 0x7E0F81F;
+    uint32_t e10 = ((uint32_t)c10 | ((uint32_t)c10 << 16)) & 0x7E0F81F;
+    uint32_t e01 = ((uint32_t)c01 | ((uint32_t)c01 << 16)) & 0x7E0F81F;
+    uint32_t e11 = ((uint32_t)c11 | ((uint32_t)c11 << 16)) & 0x7E0F81F;
+
+    uint32_t top = ((((e10 - e00) * fx) >> 5) + e00) & 0x7E0F81F;
+    uint32_t bottom = ((((e11 - e01) * fx) >> 5) + e01) & 0x7E0F81F;
+    uint32_t res = ((((bottom - top) * fy) >> 5) + top) & 0x7E0F81F;
+    return (uint16_t)((res >> 16) | res);
+}
+
+static inline lv_opa_t a8_bilinear(int32_t a00, int32_t a10, int32_t a01, int32_t a11, int32_t fx, int32_t fy)
+{
+    int32_t top = a00 + (((a10 - a00) * fx) >> 8);
+    int32_t bottom = a01 + (((a11 - a01) * fx) >> 8);
+    return (lv_opa_t)(top + (((bottom - top) * fy) >> 8));
+}
+
+/**
+ * Rotate (and scale) an RGB565 or RGB565A8 image into an RGB565 + A8 buffer.
+ * The source coordinates are stepped incrementally in 16.16 format along each row.
+ * On every row only the pixels mapped onto the image are sampled, the others are simply cleared.
+ * With anti-aliasing the 4 nearest pixels are mixed, else the nearest pixel is used.
+ * @param dest_area     the area to render relative to the image
+ * @param src           the source image
+ * @param src_w         width of the source image
+ * @param src_h         height of the source image
+ * @param src_stride    stride of the source image in bytes
+ * @param draw_dsc      the image draw descriptor with the rotation, scale, pivot and anti-aliasing
+ * @param cbuf          the destination color buffer with `lv_area_get_width(dest_area)` stride
+ * @param abuf          the destination alpha buffer with `lv_area_get_width(dest_area)` stride
+ * @param src_has_a8    true: the source is RGB565A8; false: the source is RGB565
+ */
+static void transform_rgb565a8_dda(const lv_area_t * dest_area, const uint8_t * src, int32_t src_w, int32_t src_h,
+                                   int32_t src_stride, const lv_draw_image_dsc_t * draw_dsc,
+                                   uint16_t * cbuf, uint8_t * abuf, bool src_has_a8)
+{
+    int32_t dest_w = lv_area_get_width(dest_area);
+    int32_t dest_h = lv_area_get_height(dest_area);
+    bool aa = draw_dsc->antialias;
+
+    const lv_opa_t * src_alpha = src + src_stride * src_h;
+    int32_t alpha_stride = src_stride / 2; /*alpha map stride is always half of RGB map stride*/
+
+    /*Sine and cosine of the inverse rotation from the sine table, interpolated for 0.1 degrees*/
+    int32_t angle = -draw_dsc->rotation;
+    int32_t angle_low = angle / 10;
+    int32_t angle_rem = angle - (angle_low * 10);
+    int32_t sinma = (lv_trigo_sin(angle_low) * (10 - angle_rem) + lv_trigo_sin(angle_low + 1) * angle_rem) / 10;
+    int32_t cosma = (lv_trigo_sin(angle_low + 90) * (10 - angle_rem) + lv_trigo_sin(angle_low + 91) * angle_rem) / 10;
+
+    /*Step of the source coordinates in 16.16 format when moving right or down by 1 pixel on the destination.
+     *sin and cos are in 1/32768 units and 256 scale means 100%*/
+    int32_t ux = (cosma * 512) / draw_dsc->scale_x;
+    int32_t vx = (sinma * 512) / draw_dsc->scale_y;
+    int32_t uy = -(sinma * 512) / draw_dsc->scale_x;
+    int32_t vy = (cosma * 512) / draw_dsc->scale_y;
+
+    /*The first pixel of the first row. The pixels' centers are on integer coordinates.
+     *Without anti-aliasing round to the nearest pixel*/
+    int32_t xin = dest_area->x1 - draw_dsc->pivot.x;
+    int32_t yin = dest_area->y1 - draw_dsc->pivot.y;
+    int64_t u_row = ((int64_t)draw_dsc->pivot.x << 16) + (int64_t)ux * xin + (int64_t)uy * yin;
+    int64_t v_row = ((int64_t)draw_dsc->pivot.y << 16) + (int64_t)vx * xin + (int64_t)vy * yin;
+    if(!aa) {
+        u_row += 0x8000;
+        v_row += 0x8000;
+    }
+
+    /*With anti-aliasing the pixels needs the next pixel too so use a 1 pixel border around the inner part*/
+    int64_t in_w = (int64_t)(aa ? src_w - 1 : src_w) << 16;
+    int64_t in_h = (int64_t)(aa ? src_h - 1 : src_h) << 16;
+    int64_t out_x = aa ? -0x10000 : 0;
+    int64_t out_w = (int64_t)src_w << 16;
+    int64_t out_h = (int64_t)src_h << 16;
+
+    int32_t y;
+    for(y = 0; y < dest_h; y++) {
+        /*[out_x1..out_x2) is mapped onto the image, [in_x1..in_x2) doesn't need to check the edges*/
+        int32_t out_x1 = 0;
+        int32_t out_x2 = dest_w;
+        span_clip(u_row, ux, out_x, out_w, &out_x1, &out_x2);
+        span_clip(v_row, vx, out_x, out_h, &out_x1, &out_x2);
+
+        int32_t in_x1 = out_x1;
+        int32_t in_x2 = out_x2;
+        span_clip(u_row, ux, 0, in_w, &in_x1, &in_x2);
+        span_clip(v_row, vx, 0, in_h, &in_x1, &in_x2);
+        if(in_x1 == in_x2) in_x1 = in_x2 = out_x2;
+
+        lv_memzero(abuf, out_x1);
+        lv_memzero(abuf + out_x2, dest_w - out_x2);
+
+        int32_t x = out_x1;
+        int32_t u = (int32_t)(u_row + (int64_t)ux * x);
+        int32_t v = (int32_t)(v_row + (int64_t)vx * x);
+
+        /*The edges: the pixels on the image are mixed with transparent pixels out of the image*/
+        for(; x < out_x2; x++) {
+            if(x == in_x1) {
+                /*The inner part, all the used pixels are on the image*/
+                for(; x < in_x2; x++) {
+                    int32_t xs_int = u >> 16;
+                    int32_t ys_int = v >> 16;
+                    const uint16_t * src_u16 = (const uint16_t *)(src + ys_int * src_stride) + xs_int;
+                    const lv_opa_t * src_a8 = src_alpha + ys_int * alpha_stride + xs_int;
+                    if(!aa) {
+                        cbuf[x] = src_u16[0];
+                        abuf[x] = src_has_a8 ? src_a8[0] : 0xff;
+                    }
+                    else {
+                        const uint16_t * src_u16_next = (const uint16_t *)((const uint8_t *)src_u16 + src_stride);
+                        cbuf[x] = rgb565_bilinear(src_u16[0], src_u16[1], src_u16_next[0], src_u16_next[1],
+                                                  (u >> 11) & 0x1F, (v >> 11) & 0x1F);
+                        abuf[x] = src_has_a8 ? a8_bilinear(src_a8[0], src_a8[1],
+                                                           src_a8[alpha_stride], src_a8[alpha_stride + 1],
+                                                           (u >> 8) & 0xFF, (v >> 8) & 0xFF) : 0xff;
+                    }
+                    u += ux;
+                    v += vx;
+                }
+                if(x >= out_x2) break;
+            }
+
+            int32_t xs_int = u >> 16;
+            int32_t ys_int = v >> 16;
+            int32_t xs_next = xs_int + 1;
+            int32_t ys_next = ys_int + 1;
+
+            /*Use the nearest pixel on the image for the color and 0 opacity out of the image*/
+            int32_t xs_c = LV_CLAMP(0, xs_int, src_w - 1);
+            int32_t ys_c = LV_CLAMP(0, ys_int, src_h - 1);
+            int32_t xs_next_c = LV_CLAMP(0, xs_next, src_w - 1);
+            int32_t ys_next_c = LV_CLAMP(0, ys_next, src_h - 1);
+            const uint16_t * row_u16 = (const uint16_t *)(src + ys_c * src_stride);
+            const uint16_t * row_next_u16 = (const uint16_t *)(src + ys_next_c * src_stride);
+            cbuf[x] = rgb565_bilinear(row_u16[xs_c], row_u16[xs_next_c], row_next_u16[xs_c], row_next_u16[xs_next_c],
+                                      (u >> 11) & 0x1F, (v >> 11) & 0x1F);
+
+            int32_t a[4];
+            int32_t i;
+            for(i = 0; i < 4; i++) {
+                int32_t ax = (i & 1) ? xs_next : xs_int;
+                int32_t ay = (i & 2) ? ys_next : ys_int;
+                if(ax < 0 || ax >= src_w || ay < 0 || ay >= src_h) a[i] = 0;
+                else a[i] = src_has_a8 ? src_alpha[ay * alpha_stride + ax] : 0xff;
+            }
+            abuf[x] = a8_bilinear(a[0], a[1], a[2], a[3], (u >> 8) & 0xFF, (v >> 8) & 0xFF);
+
+            u += ux;
+            v += vx;
+        }
+
+        u_row += uy;
+        v_row += vy;
+        cbuf += dest_w;
+        abuf += dest_w;
+    }
+}
+
+#endif
+
 #if LV_DRAW_SW_SUPPORT_RGB565_SWAPPED
 
 static void transform_rgb565a8_swapped(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
@@ -13,6 +13,9 @@
 #include "../misc/lv_types.h"
 #include "../misc/lv_log.h"
 #include "../misc/lv_utils.h"
+#include "../misc/cache/lv_cache.h"
+#include "../misc/cache/lv_cache_private.h"
+#include "../draw/lv_draw_buf_private.h"
 #include "../stdlib/lv_mem.h"
 
 /*********************
@@ -22,6 +25,20 @@
     #define font_rle LV_GLOBAL_DEFAULT()->font_fmt_rle
 #endif /*LV_USE_FONT_COMPRESSED*/
 
+#if LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE
+    #if (LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE & (LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE - 1)) != 0
+        #error "LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE must be a power of 2"
+    #endif
+    #define gid_cache LV_GLOBAL_DEFAULT()->font_fmt_gid_cache
+#endif
+
+#define font_index_ll_p &(LV_GLOBAL_DEFAULT()->font_fmt_index_ll)
+#define glyph_cache_p LV_GLOBAL_DEFAULT()->font_fmt_glyph_cache
+#define glyph_cache_stats LV_GLOBAL_DEFAULT()->font_fmt_glyph_cache_stats
+#define font_draw_buf_handlers &(LV_GLOBAL_DEFAULT()->font_draw_buf_handlers)
+
+#define GLYPH_CACHE_NAME "FONT_FMT_TXT_GLYPH"
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -30,10 +47,32 @@ typedef struct {
     uint32_t gid_right;
 } kern_pair_ref_t;
 
+typedef void (*glyph_cb_t)(lv_font_fmt_txt_index_t * index, uint32_t letter, uint32_t gid);
+
+typedef struct {
+    lv_cache_slot_size_t slot;
+
+    const lv_font_fmt_txt_dsc_t * fdsc;
+    uint32_t gid;
+
+    lv_draw_buf_t * draw_buf;   /**< The A8 bitmap of the glyph*/
+} glyph_cache_data_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static const void * get_bitmap(const lv_font_fmt_txt_dsc_t * fdsc, const lv_font_fmt_txt_glyph_dsc_t * gdsc,
+                               uint16_t stride_in, lv_draw_buf_t * draw_buf);
+static lv_draw_buf_t * get_cached_bitmap(lv_font_glyph_dsc_t * g_dsc);
+static lv_cache_compare_res_t glyph_cache_compare_cb(const glyph_cache_data_t * lhs, const glyph_cache_data_t * rhs);
+static void glyph_cache_free_cb(glyph_cache_data_t * data, void * user_data);
 static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter);
+static uint32_t get_glyph_dsc_id_from_cmaps(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t letter);
+static lv_font_fmt_txt_index_t * find_index(const lv_font_fmt_txt_dsc_t * fdsc);
+static uint32_t get_glyph_dsc_id_from_index(const lv_font_fmt_txt_index_t * index, uint32_t letter);
+static void for_each_glyph(lv_font_fmt_txt_index_t * index, glyph_cb_t cb);
+static void index_count_cb(lv_font_fmt_txt_index_t * index, uint32_t letter, uint32_t gid);
+static void index_add_cb(lv_font_fmt_txt_index_t * index, uint32_t letter, uint32_t gid);
 static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t gid_right);
 static int unicode_list_compare(const void * ref, const void * element);
 static int kern_pair_8_compare(const void * ref, const void * element);
@@ -99,11 +138,257 @@ const void * lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf
 
     if(g_dsc->req_raw_bitmap) return &fdsc->glyph_bitmap[gdsc->bitmap_index];
 
-    uint8_t * bitmap_out = draw_buf->data;
     int32_t gsize = (int32_t) gdsc->box_w * gdsc->box_h;
     if(gsize == 0) return NULL;
 
-    uint16_t stride_in = g_dsc->stride;
+    if(glyph_cache_p && lv_cache_is_enabled(glyph_cache_p)) {
+        lv_draw_buf_t * cached = get_cached_bitmap(g_dsc);
+        if(cached) return cached;
+    }
+
+    return get_bitmap(fdsc, gdsc, g_dsc->stride, draw_buf);
+}
+
+void lv_font_release_glyph_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t * g_dsc)
+{
+    LV_UNUSED(font);
+
+    if(g_dsc->entry == NULL) return;
+
+    lv_cache_release(glyph_cache_p, g_dsc->entry, NULL);
+    g_dsc->entry = NULL;
+}
+
+bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter,
+                                   uint32_t unicode_letter_next)
+{
+    /*It fixes a strange compiler optimization issue: https://github.com/lvgl/lvgl/issues/4370*/
+    bool is_tab = unicode_letter == '\t';
+    if(is_tab) {
+        unicode_letter = ' ';
+    }
+    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
+    uint32_t gid = get_glyph_dsc_id(font, unicode_letter);
+    if(!gid) return false;
+
+    int8_t kvalue = 0;
+    if(fdsc->kern_dsc) {
+        uint32_t gid_next = get_glyph_dsc_id(font, unicode_letter_next);
+        if(gid_next) {
+            kvalue = get_kern_value(font, gid, gid_next);
+        }
+    }
+
+    /*Put together a glyph dsc*/
+    const lv_font_fmt_txt_glyph_dsc_t * gdsc = &fdsc->glyph_dsc[gid];
+
+    int32_t kv = ((int32_t)((int32_t)kvalue * fdsc->kern_scale) >> 4);
+
+    uint32_t adv_w = gdsc->adv_w;
+    if(is_tab) adv_w *= 2;
+
+    adv_w += kv;
+    adv_w  = (adv_w + (1 << 3)) >> 4;
+
+    dsc_out->adv_w = adv_w;
+    dsc_out->box_h = gdsc->box_h;
+    dsc_out->box_w = gdsc->box_w;
+    dsc_out->ofs_x = gdsc->ofs_x;
+    dsc_out->ofs_y = gdsc->ofs_y;
+
+    if(fdsc->stride == 0) dsc_out->stride = 0;
+    else {
+        /*e.g. font_dsc stride ==  4 means align to 4 byte boundary.
+         *In glyph_dsc store the actual line length in bytes*/
+        dsc_out->stride = LV_ROUND_UP(dsc_out->box_w, fdsc->stride);
+    }
+
+    dsc_out->format = (uint8_t)fdsc->bpp;
+    dsc_out->is_placeholder = false;
+    dsc_out->gid.index = gid;
+
+    if(is_tab) dsc_out->box_w = dsc_out->box_w * 2;
+
+    return true;
+}
+
+lv_result_t lv_font_fmt_txt_create_index(const lv_font_t * font)
+{
+    LV_ASSERT_NULL(font);
+    if(font->get_glyph_dsc != lv_font_get_glyph_dsc_fmt_txt) return LV_RESULT_INVALID;
+
+    const lv_font_fmt_txt_dsc_t * fdsc = font->dsc;
+    if(find_index(fdsc)) return LV_RESULT_OK;
+    if(fdsc->cmap_num == 0) return LV_RESULT_INVALID;
+
+    uint32_t letter_min = UINT32_MAX;
+    uint32_t letter_max = 0;
+    uint16_t i;
+    for(i = 0; i < fdsc->cmap_num; i++) {
+        const lv_font_fmt_txt_cmap_t * cmap = &fdsc->cmaps[i];
+        if(cmap->range_length == 0) continue;
+        /*The glyph IDs are stored on 16 bits*/
+        if(cmap->glyph_id_start + LV_MAX(cmap->range_length, cmap->list_length) > 0xFFFF) return LV_RESULT_INVALID;
+        letter_min = LV_MIN(letter_min, cmap->range_start);
+        letter_max = LV_MAX(letter_max, cmap->range_start + cmap->range_length - 1);
+    }
+    if(letter_min > letter_max) return LV_RESULT_INVALID;
+
+    lv_font_fmt_txt_index_t index;
+    lv_memzero(&index, sizeof(index));
+    index.fdsc = fdsc;
+    index.page_first = letter_min >> 8;
+    index.page_cnt = (letter_max >> 8) - index.page_first + 1;
+
+    /*Count the glyphs of the pages, shifted by one to get the start indices by summing them up*/
+    index.page_start = lv_malloc_zeroed((index.page_cnt + 1) * sizeof(uint32_t));
+    if(index.page_start == NULL) return LV_RESULT_INVALID;
+
+    for_each_glyph(&index, index_count_cb);
+
+    uint32_t p;
+    for(p = 0; p < index.page_cnt; p++) {
+        index.page_start[p + 1] += index.page_start[p];
+    }
+
+    uint32_t glyph_cnt = index.page_start[index.page_cnt];
+    index.low = lv_malloc(glyph_cnt ? glyph_cnt : 1);
+    index.gid = lv_malloc((glyph_cnt ? glyph_cnt : 1) * sizeof(uint16_t));
+    lv_font_fmt_txt_index_t * index_p = lv_ll_ins_tail(font_index_ll_p);
+    if(index.low == NULL || index.gid == NULL || index_p == NULL) {
+        lv_free(index.page_start);
+        lv_free(index.low);
+        lv_free(index.gid);
+        if(index_p) lv_ll_remove(font_index_ll_p, index_p);
+        lv_free(index_p);
+        LV_LOG_WARN("Out of memory");
+        return LV_RESULT_INVALID;
+    }
+
+    /*`page_start[p]` is used as the write position of page `p` while adding the glyphs,
+     *so at the end each one contains the start of the next page.*/
+    for_each_glyph(&index, index_add_cb);
+    for(p = index.page_cnt; p > 0; p--) {
+        index.page_start[p] = index.page_start[p - 1];
+    }
+    index.page_start[0] = 0;
+
+    /*Sort the pages by the low bytes. The character maps are usually in order so it's fast.*/
+    for(p = 0; p < index.page_cnt; p++) {
+        uint32_t j;
+        for(j = index.page_start[p] + 1; j < index.page_start[p + 1]; j++) {
+            uint8_t low = index.low[j];
+            uint16_t gid = index.gid[j];
+            uint32_t k = j;
+            while(k > index.page_start[p] && index.low[k - 1] > low) {
+                index.low[k] = index.low[k - 1];
+                index.gid[k] = index.gid[k - 1];
+                k--;
+            }
+            index.low[k] = low;
+            index.gid[k] = gid;
+        }
+    }
+
+    *index_p = index;
+
+    return LV_RESULT_OK;
+}
+
+void lv_font_fmt_txt_delete_index(const lv_font_t * font)
+{
+    LV_ASSERT_NULL(font);
+
+    lv_font_fmt_txt_index_t * index = find_index(font->dsc);
+    if(index == NULL) return;
+
+    lv_free(index->page_start);
+    lv_free(index->low);
+    lv_free(index->gid);
+    lv_ll_remove(font_index_ll_p, index);
+    lv_free(index);
+}
+
+void lv_font_fmt_txt_drop_cache(const lv_font_t * font)
+{
+    LV_ASSERT_NULL(font);
+
+    lv_font_fmt_txt_delete_index(font);
+
+    /*The bitmaps are not grouped by fonts, so simply drop all of them. Fonts are rarely deleted.*/
+    if(glyph_cache_p) lv_cache_drop_all(glyph_cache_p, NULL);
+
+#if LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE
+    uint32_t i;
+    for(i = 0; i < LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE; i++) {
+        if(gid_cache[i].fdsc == font->dsc) gid_cache[i].fdsc = NULL;
+    }
+#endif
+}
+
+void lv_font_fmt_txt_glyph_cache_init(uint32_t max_size)
+{
+    lv_cache_ops_t ops = {
+        .compare_cb = (lv_cache_compare_cb_t)glyph_cache_compare_cb,
+        .create_cb = NULL,
+        .free_cb = (lv_cache_free_cb_t)glyph_cache_free_cb,
+    };
+
+    glyph_cache_p = lv_cache_create(&lv_cache_class_lru_rb_size, sizeof(glyph_cache_data_t), max_size, ops);
+    lv_cache_set_name(glyph_cache_p, GLYPH_CACHE_NAME);
+}
+
+void lv_font_fmt_txt_glyph_cache_deinit(void)
+{
+    if(glyph_cache_p == NULL) return;
+
+    lv_cache_destroy(glyph_cache_p, NULL);
+    glyph_cache_p = NULL;
+}
+
+void lv_font_fmt_txt_index_deinit(void)
+{
+    lv_font_fmt_txt_index_t * index;
+    LV_LL_READ(font_index_ll_p, index) {
+        lv_free(index->page_start);
+        lv_free(index->low);
+        lv_free(index->gid);
+    }
+    lv_ll_clear(font_index_ll_p);
+}
+
+void lv_font_fmt_txt_glyph_cache_get_stats(lv_font_fmt_txt_glyph_cache_stats_t * stats)
+{
+    LV_ASSERT_NULL(stats);
+
+    *stats = glyph_cache_stats;
+    if(glyph_cache_p) {
+        stats->size = (uint32_t)lv_cache_get_size(glyph_cache_p, NULL);
+        stats->max_size = (uint32_t)lv_cache_get_max_size(glyph_cache_p, NULL);
+    }
+}
+
+void lv_font_fmt_txt_glyph_cache_reset_stats(void)
+{
+    lv_memzero(&glyph_cache_stats, sizeof(glyph_cache_stats));
+}
+
+void lv_font_fmt_txt_glyph_cache_resize(uint32_t new_size)
+{
+    if(glyph_cache_p == NULL) return;
+
+    lv_cache_set_max_size(glyph_cache_p, new_size, NULL);
+    lv_cache_reserve(glyph_cache_p, 0, NULL);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static const void * get_bitmap(const lv_font_fmt_txt_dsc_t * fdsc, const lv_font_fmt_txt_glyph_dsc_t * gdsc,
+                               uint16_t stride_in, lv_draw_buf_t * draw_buf)
+{
+    uint8_t * bitmap_out = draw_buf->data;
 
     if(fdsc->bitmap_format == LV_FONT_FMT_TXT_PLAIN) {
         const uint8_t * bitmap_in = &fdsc->glyph_bitmap[gdsc->bitmap_index];
@@ -218,69 +503,99 @@ const void * lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf
     return NULL;
 }
 
-bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter,
-                                   uint32_t unicode_letter_next)
+/**
+ * Get the A8 bitmap of a glyph from the glyph cache or add it to the cache.
+ * The returned draw buffer is used until `lv_font_release_glyph_fmt_txt` is called.
+ * @param g_dsc     the glyph descriptor, its `entry` is set to the acquired cache entry
+ * @return          the cached bitmap or NULL if the glyph couldn't be cached
+ */
+static lv_draw_buf_t * get_cached_bitmap(lv_font_glyph_dsc_t * g_dsc)
 {
-    /*It fixes a strange compiler optimization issue: https://github.com/lvgl/lvgl/issues/4370*/
-    bool is_tab = unicode_letter == '\t';
-    if(is_tab) {
-        unicode_letter = ' ';
-    }
-    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
-    uint32_t gid = get_glyph_dsc_id(font, unicode_letter);
-    if(!gid) return false;
-
-    int8_t kvalue = 0;
-    if(fdsc->kern_dsc) {
-        uint32_t gid_next = get_glyph_dsc_id(font, unicode_letter_next);
-        if(gid_next) {
-            kvalue = get_kern_value(font, gid, gid_next);
-        }
+    const lv_font_fmt_txt_dsc_t * fdsc = g_dsc->resolved_font->dsc;
+    const lv_font_fmt_txt_glyph_dsc_t * gdsc = &fdsc->glyph_dsc[g_dsc->gid.index];
+
+    glyph_cache_data_t search_key;
+    lv_memzero(&search_key, sizeof(search_key));
+    search_key.fdsc = fdsc;
+    search_key.gid = g_dsc->gid.index;
+
+    lv_cache_entry_t * entry = lv_cache_acquire(glyph_cache_p, &search_key, NULL);
+    if(entry) {
+        glyph_cache_stats.hit_cnt++;
+        g_dsc->entry = entry;
+        glyph_cache_data_t * cached_data = lv_cache_entry_get_data(entry);
+        return cached_data->draw_buf;
     }
 
-    /*Put together a glyph dsc*/
-    const lv_font_fmt_txt_glyph_dsc_t * gdsc = &fdsc->glyph_dsc[gid];
+    glyph_cache_stats.miss_cnt++;
 
-    int32_t kv = ((int32_t)((int32_t)kvalue * fdsc->kern_scale) >> 4);
+    uint32_t stride = lv_draw_buf_width_to_stride(gdsc->box_w, LV_COLOR_FORMAT_A8);
+    search_key.slot.size = stride * gdsc->box_h + sizeof(lv_draw_buf_t);
+    if(search_key.slot.size > lv_cache_get_max_size(glyph_cache_p, NULL)) return NULL;
 
-    uint32_t adv_w = gdsc->adv_w;
-    if(is_tab) adv_w *= 2;
+    entry = lv_cache_add(glyph_cache_p, &search_key, NULL);
+    if(entry == NULL) return NULL;
 
-    adv_w += kv;
-    adv_w  = (adv_w + (1 << 3)) >> 4;
+    glyph_cache_data_t * cached_data = lv_cache_entry_get_data(entry);
+    cached_data->draw_buf = lv_draw_buf_create_ex(font_draw_buf_handlers, gdsc->box_w, gdsc->box_h,
+                                                  LV_COLOR_FORMAT_A8, stride);
+    if(cached_data->draw_buf == NULL || get_bitmap(fdsc, gdsc, g_dsc->stride, cached_data->draw_buf) == NULL) {
+        lv_cache_drop(glyph_cache_p, &search_key, NULL);
+        lv_cache_release(glyph_cache_p, entry, NULL);
+        return NULL;
+    }
 
-    dsc_out->adv_w = adv_w;
-    dsc_out->box_h = gdsc->box_h;
-    dsc_out->box_w = gdsc->box_w;
-    dsc_out->ofs_x = gdsc->ofs_x;
-    dsc_out->ofs_y = gdsc->ofs_y;
+    g_dsc->entry = entry;
+    return cached_data->draw_buf;
+}
 
-    if(fdsc->stride == 0) dsc_out->stride = 0;
-    else {
-        /*e.g. font_dsc stride ==  4 means align to 4 byte boundary.
-         *In glyph_dsc store the actual line length in bytes*/
-        dsc_out->stride = LV_ROUND_UP(dsc_out->box_w, fdsc->stride);
+static lv_cache_compare_res_t glyph_cache_compare_cb(const glyph_cache_data_t * lhs, const glyph_cache_data_t * rhs)
+{
+    if(lhs->fdsc != rhs->fdsc) {
+        return lhs->fdsc > rhs->fdsc ? 1 : -1;
     }
+    if(lhs->gid != rhs->gid) {
+        return lhs->gid > rhs->gid ? 1 : -1;
+    }
+    return 0;
+}
 
-    dsc_out->format = (uint8_t)fdsc->bpp;
-    dsc_out->is_placeholder = false;
-    dsc_out->gid.index = gid;
-
-    if(is_tab) dsc_out->box_w = dsc_out->box_w * 2;
+static void glyph_cache_free_cb(glyph_cache_data_t * data, void * user_data)
+{
+    LV_UNUSED(user_data);
 
-    return true;
+    if(data->draw_buf) lv_draw_buf_destroy(data->draw_buf);
 }
 
-/**********************
- *   STATIC FUNCTIONS
- **********************/
-
 static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
 {
     if(letter == '\0') return 0;
 
-    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
+    const lv_font_fmt_txt_dsc_t * fdsc = font->dsc;
+
+#if LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE
+    /*Mix the font into the slot so that the same letters of different fonts don't evict each other*/
+    uint32_t slot = (letter + (uint32_t)((lv_uintptr_t)fdsc >> 4) * 31) & (LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE - 1);
+    lv_font_fmt_txt_gid_cache_entry_t * entry = &gid_cache[slot];
+    if(entry->fdsc == fdsc && entry->letter == letter) return entry->gid;
+#endif
+
+    uint32_t glyph_id;
+    const lv_font_fmt_txt_index_t * index = find_index(fdsc);
+    if(index) glyph_id = get_glyph_dsc_id_from_index(index, letter);
+    else glyph_id = get_glyph_dsc_id_from_cmaps(fdsc, letter);
+
+#if LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE
+    entry->fdsc = fdsc;
+    entry->letter = letter;
+    entry->gid = glyph_id;
+#endif
 
+    return glyph_id;
+}
+
+static uint32_t get_glyph_dsc_id_from_cmaps(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t letter)
+{
     uint16_t i;
     for(i = 0; i < fdsc->cmap_num; i++) {
 
@@ -328,6 +643,93 @@ static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
 
 }
 
+static lv_font_fmt_txt_index_t * find_index(const lv_font_fmt_txt_dsc_t * fdsc)
+{
+    lv_font_fmt_txt_index_t * index;
+    LV_LL_READ(font_index_ll_p, index) {
+        if(index->fdsc == fdsc) return index;
+    }
+
+    return NULL;
+}
+
+static uint32_t get_glyph_dsc_id_from_index(const lv_font_fmt_txt_index_t * index, uint32_t letter)
+{
+    uint32_t page = (letter >> 8) - index->page_first;
+    if(page >= index->page_cnt) return 0;
+
+    uint8_t low = letter & 0xff;
+    uint32_t first = index->page_start[page];
+    uint32_t last = index->page_start[page + 1];
+    while(first < last) {
+        uint32_t mid = (first + last) >> 1;
+        if(index->low[mid] < low) first = mid + 1;
+        else if(index->low[mid] > low) last = mid;
+        else return index->gid[mid];
+    }
+
+    return 0;
+}
+
+/**
+ * Call `cb` with all letters of a font which `get_glyph_dsc_id_from_cmaps` would find.
+ * A letter belongs to the first character map whose range contains it, except missing
+ * letters of `LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL` maps which are looked up in the next maps too.
+ */
+static void for_each_glyph(lv_font_fmt_txt_index_t * index, glyph_cb_t cb)
+{
+    const lv_font_fmt_txt_dsc_t * fdsc = index->fdsc;
+    uint16_t i;
+    for(i = 0; i < fdsc->cmap_num; i++) {
+        const lv_font_fmt_txt_cmap_t * cmap = &fdsc->cmaps[i];
+        uint32_t cnt = cmap->type == LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY ||
+                       cmap->type == LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL ? cmap->range_length : cmap->list_length;
+        uint32_t j;
+        for(j = 0; j < cnt; j++) {
+            uint32_t letter;
+            uint32_t gid;
+            if(cmap->type == LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY) {
+                letter = cmap->range_start + j;
+                gid = cmap->glyph_id_start + j;
+            }
+            else if(cmap->type == LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL) {
+                const uint8_t * gid_ofs_8 = cmap->glyph_id_ofs_list;
+                if(gid_ofs_8[j] == 0 && j != 0) continue;
+                letter = cmap->range_start + j;
+                gid = cmap->glyph_id_start + gid_ofs_8[j];
+            }
+            else if(cmap->type == LV_FONT_FMT_TXT_CMAP_SPARSE_TINY) {
+                letter = cmap->range_start + cmap->unicode_list[j];
+                gid = cmap->glyph_id_start + j;
+            }
+            else {
+                const uint16_t * gid_ofs_16 = cmap->glyph_id_ofs_list;
+                letter = cmap->range_start + cmap->unicode_list[j];
+                gid = cmap->glyph_id_start + gid_ofs_16[j];
+            }
+
+            /*Skip the letter if an earlier character map claims it*/
+            if(i > 0 && get_glyph_dsc_id_from_cmaps(fdsc, letter) != gid) continue;
+
+            cb(index, letter, gid);
+        }
+    }
+}
+
+static void index_count_cb(lv_font_fmt_txt_index_t * index, uint32_t letter, uint32_t gid)
+{
+    LV_UNUSED(gid);
+    index->page_start[(letter >> 8) - index->page_first + 1]++;
+}
+
+static void index_add_cb(lv_font_fmt_txt_index_t * index, uint32_t letter, uint32_t gid)
+{
+    uint32_t page = (letter >> 8) - index->page_first;
+    uint32_t pos = index->page_start[page]++;
+    index->low[pos] = letter & 0xff;
+    index->gid[pos] = (uint16_t)gid;
+}
+
 static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t gid_right)
 {
     lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
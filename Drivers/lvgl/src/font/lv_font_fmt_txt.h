@@ -193,6 +193,13 @@ typedef struct {
     uint8_t stride;
 } lv_font_fmt_txt_dsc_t;
 
+typedef struct {
+    uint32_t hit_cnt;           /**< Number of glyph bitmaps found in the cache*/
+    uint32_t miss_cnt;          /**< Number of glyph bitmaps which had to be rendered*/
+    uint32_t size;              /**< Memory used by the cached bitmaps [bytes]*/
+    uint32_t max_size;          /**< Size of the cache [bytes]*/
+} lv_font_fmt_txt_glyph_cache_stats_t;
+
 typedef struct {
     const lv_font_t * font_p; /**< Pointer to built-in font*/
     uint32_t size; /** < Size of the built-in font*/
@@ -212,6 +219,14 @@ LV_ATTRIBUTE_EXTERN_DATA extern const lv_font_class_t lv_builtin_font_class;
  */
 const void * lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf_t * draw_buf);
 
+/**
+ * Release the cached bitmap returned by `lv_font_get_bitmap_fmt_txt`.
+ * Called by `lv_font_glyph_release_draw_data` if the font has no `release_glyph` callback.
+ * @param font          pointer to font
+ * @param g_dsc         the glyph descriptor passed to `lv_font_get_bitmap_fmt_txt`
+ */
+void lv_font_release_glyph_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t * g_dsc);
+
 /**
  * Used as `get_glyph_dsc` callback in lvgl's native font format if the font is uncompressed.
  * @param font pointer to font
@@ -224,6 +239,40 @@ const void * lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf
 bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter,
                                    uint32_t unicode_letter_next);
 
+/**
+ * Create a flattened index of all character maps of a font to find the glyphs of letters faster.
+ * Useful for fonts with large sparse character maps (e.g. CJK fonts), where finding
+ * a glyph needs a binary search in a long list. It takes about 3 bytes per glyph + 4 bytes
+ * per 256 code points from the first to the last glyph.
+ * @param font      pointer to a font using `lv_font_get_glyph_dsc_fmt_txt`
+ * @return          LV_RESULT_OK: the index is created or already exists;
+ *                  LV_RESULT_INVALID: not a `fmt_txt` font or out of memory
+ */
+lv_result_t lv_font_fmt_txt_create_index(const lv_font_t * font);
+
+/**
+ * Delete the index created by `lv_font_fmt_txt_create_index`.
+ * @param font      pointer to a font
+ */
+void lv_font_fmt_txt_delete_index(const lv_font_t * font);
+
+/**
+ * Get the statistics of the glyph bitmap cache.
+ * @param stats     store the result here
+ */
+void lv_font_fmt_txt_glyph_cache_get_stats(lv_font_fmt_txt_glyph_cache_stats_t * stats);
+
+/**
+ * Reset the counters of the glyph bitmap cache.
+ */
+void lv_font_fmt_txt_glyph_cache_reset_stats(void);
+
+/**
+ * Change the size of the glyph bitmap cache.
+ * @param new_size  the new size in bytes, 0 to disable the cache
+ */
+void lv_font_fmt_txt_glyph_cache_resize(uint32_t new_size);
+
 /**********************
  *      MACROS
  **********************/
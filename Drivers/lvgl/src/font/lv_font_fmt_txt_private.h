@@ -15,6 +15,7 @@ extern "C" {
  *********************/
 
 #include "lv_font_fmt_txt.h"
+#include "../misc/lv_ll.h"
 
 /*********************
  *      DEFINES
@@ -41,10 +42,54 @@ typedef struct {
 } lv_font_fmt_rle_t;
 #endif
 
+/** An entry of the direct-mapped code point -> glyph ID cache*/
+typedef struct {
+    const lv_font_fmt_txt_dsc_t * fdsc;
+    uint32_t letter;
+    uint32_t gid;           /**< 0 if the font has no glyph for `letter`*/
+} lv_font_fmt_txt_gid_cache_entry_t;
+
+/**
+ * Flattened index of all character maps of a font.
+ * The code points are grouped into pages of 256. In a page the glyphs are
+ * found by a binary search on the low byte of their code points.
+ */
+typedef struct {
+    const lv_font_fmt_txt_dsc_t * fdsc;
+    uint32_t page_first;    /**< Page (code point >> 8) of the first glyph*/
+    uint32_t page_cnt;
+    uint32_t * page_start;  /**< `page_cnt + 1` indices into `low` and `gid` where the pages start*/
+    uint8_t * low;          /**< Low byte of the code points, ascending within a page*/
+    uint16_t * gid;         /**< Glyph ID belonging to the same index in `low`*/
+} lv_font_fmt_txt_index_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 
+/**
+ * Initialize the cache of the rendered glyph bitmaps
+ * @param max_size  size of the cache in bytes
+ */
+void lv_font_fmt_txt_glyph_cache_init(uint32_t max_size);
+
+/**
+ * Drop all cached glyph bitmaps and free the cache
+ */
+void lv_font_fmt_txt_glyph_cache_deinit(void);
+
+/**
+ * Free the flattened character map indexes of all fonts
+ */
+void lv_font_fmt_txt_index_deinit(void);
+
+/**
+ * Delete the index and the cached glyph IDs of a font.
+ * Needs to be called before a `lv_font_fmt_txt` font is freed.
+ * @param font      pointer to a font
+ */
+void lv_font_fmt_txt_drop_cache(const lv_font_t * font);
+
 /**********************
  *      MACROS
  **********************/
@@ -471,12 +471,12 @@ static void children_repos(lv_obj_t * cont, flex_t * f, int32_t item_first_id, i
         diff_y += f->row ? cross_pos : main_pos + get_margin_main_start(item, LV_PART_MAIN);
 
         if(diff_x || diff_y) {
-            lv_obj_invalidate(item);
+            lv_obj_invalidate_moved(item);
             item->coords.x1 += diff_x;
             item->coords.x2 += diff_x;
             item->coords.y1 += diff_y;
             item->coords.y2 += diff_y;
-            lv_obj_invalidate(item);
+            lv_obj_invalidate_moved(item);
             lv_obj_move_children_by(item, diff_x, diff_y, false);
         }
 
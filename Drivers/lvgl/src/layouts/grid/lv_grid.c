@@ -563,12 +563,12 @@ static void item_repos(lv_obj_t * item, lv_grid_calc_t * c, item_repos_hint_t *
     int32_t diff_x = hint->grid_abs.x + x - item->coords.x1;
     int32_t diff_y = hint->grid_abs.y + y - item->coords.y1;
     if(diff_x || diff_y) {
-        lv_obj_invalidate(item);
+        lv_obj_invalidate_moved(item);
         item->coords.x1 += diff_x;
         item->coords.x2 += diff_x;
         item->coords.y1 += diff_y;
         item->coords.y2 += diff_y;
-        lv_obj_invalidate(item);
+        lv_obj_invalidate_moved(item);
         lv_obj_move_children_by(item, diff_x, diff_y, false);
     }
 }
@@ -47,6 +47,18 @@ typedef struct _lv_image_compressed_t {
     const uint8_t * data; /*Compressed data*/
 } lv_image_compressed_t;
 
+/**
+ * Index at the beginning of the compressed data of `LV_IMAGE_COMPRESS_..._BLOCKS` images.
+ * It's followed by `block_cnt + 1` `uint32_t` offsets of the compressed blocks, relative to the end
+ * of the offset table. The last offset is the end of the last block.
+ * A decompressed block contains the rows of the block in the same format as a draw buffer with
+ * `block_h` rows, i.e. for RGB565A8 the RGB565 rows followed by the A8 rows.
+ */
+typedef struct {
+    uint16_t block_h;   /*Number of rows in a block. The last block can be shorter.*/
+    uint16_t block_cnt; /*Number of blocks*/
+} lv_image_block_index_t;
+
 typedef struct {
     lv_fs_file_t * f;
     lv_color32_t * palette;
@@ -56,6 +68,8 @@ typedef struct {
     lv_draw_buf_t * decompressed;       /*Decompressed data could be used directly, thus must also be draw buf*/
     lv_draw_buf_t c_array;              /*An C-array image that need to be converted to a draw buf*/
     lv_draw_buf_t * decoded_partial;    /*A draw buf for decoded image via get_area_cb*/
+    lv_image_block_index_t block_index; /*Row blocks of block compressed images*/
+    const uint8_t * block_offsets;      /*Offset table of the blocks, it might be unaligned*/
 } decoder_data_t;
 
 /**********************
@@ -77,6 +91,12 @@ static lv_fs_res_t fs_read_file_at(lv_fs_file_t * f, uint32_t pos, void * buff,
 
 static lv_result_t decompress_image(lv_image_decoder_dsc_t * dsc, const lv_image_compressed_t * compressed);
 
+static bool is_block_compressed(const lv_image_decoder_dsc_t * dsc);
+static lv_result_t open_block_compressed(lv_image_decoder_dsc_t * dsc);
+static lv_result_t get_area_block_compressed(lv_image_decoder_dsc_t * dsc, const lv_area_t * full_area,
+                                             lv_area_t * decoded_area);
+static uint32_t get_block_offset(const uint8_t * offsets, uint32_t idx);
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -261,7 +281,11 @@ lv_result_t lv_bin_decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_d
         }
 
         lv_color_format_t cf = image->header.cf;
-        if(dsc->header.flags & LV_IMAGE_FLAGS_COMPRESSED) {
+        if(is_block_compressed(dsc)) {
+            /*Decompress only the needed rows in get_area_cb*/
+            res = open_block_compressed(dsc);
+        }
+        else if(dsc->header.flags & LV_IMAGE_FLAGS_COMPRESSED) {
             res = decode_compressed(decoder, dsc);
         }
         else if(LV_COLOR_FORMAT_IS_INDEXED(cf)) {
@@ -403,6 +427,10 @@ lv_result_t lv_bin_decoder_get_area(lv_image_decoder_t * decoder, lv_image_decod
 {
     LV_UNUSED(decoder); /*Unused*/
 
+    if(is_block_compressed(dsc)) {
+        return get_area_block_compressed(dsc, full_area, decoded_area);
+    }
+
     lv_color_format_t cf = dsc->header.cf;
     /*Check if cf is supported*/
 
@@ -963,7 +991,7 @@ static lv_result_t decode_compressed(lv_image_decoder_t * decoder, lv_image_deco
             return LV_RESULT_INVALID;
         }
 
-        file_buf = lv_malloc(compressed_len);
+        file_buf = lv_malloc_region(compressed_len, LV_MEM_REGION_LARGE);
         if(file_buf == NULL) {
             LV_LOG_WARN("No memory for compressed file");
             return LV_RESULT_INVALID;
@@ -1201,3 +1229,163 @@ static lv_result_t decompress_image(lv_image_decoder_dsc_t * dsc, const lv_image
     return LV_RESULT_INVALID;
 #endif /* (LV_USE_LZ4 || LV_USE_RLE) */
 }
+
+static bool is_block_compressed(const lv_image_decoder_dsc_t * dsc)
+{
+    if((dsc->header.flags & LV_IMAGE_FLAGS_COMPRESSED) == 0) return false;
+    if(dsc->src_type != LV_IMAGE_SRC_VARIABLE) return false;
+
+    const lv_image_dsc_t * image = dsc->src;
+    if(image->data == NULL || image->data_size < 12) return false;
+
+    uint32_t method = ((const lv_image_compressed_t *)image->data)->method;
+    return method == LV_IMAGE_COMPRESS_RLE_BLOCKS || method == LV_IMAGE_COMPRESS_LZ4_BLOCKS;
+}
+
+/**
+ * Check the index of a block compressed image. The blocks are decompressed later in `get_area_cb`.
+ */
+static lv_result_t open_block_compressed(lv_image_decoder_dsc_t * dsc)
+{
+    const lv_image_dsc_t * image = dsc->src;
+    lv_image_compressed_t compressed;
+    uint32_t header_len = 12;
+    lv_memcpy(&compressed, image->data, header_len);
+
+    if(compressed.method == LV_IMAGE_COMPRESS_RLE_BLOCKS) {
+#if !LV_USE_RLE
+        LV_LOG_WARN("RLE decompression is not enabled");
+        return LV_RESULT_INVALID;
+#endif
+    }
+    else {
+#if !LV_USE_LZ4
+        LV_LOG_WARN("LZ4 decompression is not enabled");
+        return LV_RESULT_INVALID;
+#endif
+    }
+
+    if(LV_COLOR_FORMAT_IS_INDEXED(dsc->header.cf)) {
+        LV_LOG_WARN("Block compression is not supported for indexed images");
+        return LV_RESULT_INVALID;
+    }
+
+    if(compressed.compressed_size != image->data_size - header_len) {
+        LV_LOG_WARN("Compressed size mismatch: %" LV_PRIu32" != %" LV_PRIu32, compressed.compressed_size,
+                    image->data_size - header_len);
+        return LV_RESULT_INVALID;
+    }
+
+    if(compressed.compressed_size < sizeof(lv_image_block_index_t)) {
+        LV_LOG_WARN("Block index doesn't fit into the compressed data");
+        return LV_RESULT_INVALID;
+    }
+
+    lv_image_block_index_t index;
+    lv_memcpy(&index, image->data + header_len, sizeof(index));
+    const uint8_t * offsets = image->data + header_len + sizeof(index);
+    uint32_t index_len = sizeof(index) + (index.block_cnt + 1) * sizeof(uint32_t);
+    if(index.block_h == 0 || index.block_cnt != (dsc->header.h + index.block_h - 1) / index.block_h ||
+       index_len > compressed.compressed_size ||
+       index_len + get_block_offset(offsets, index.block_cnt) != compressed.compressed_size) {
+        LV_LOG_WARN("Invalid block index");
+        return LV_RESULT_INVALID;
+    }
+
+    decoder_data_t * decoder_data = get_decoder_data(dsc);
+    if(decoder_data == NULL) {
+        return LV_RESULT_INVALID;
+    }
+
+    decoder_data->block_index = index;
+    decoder_data->block_offsets = offsets;
+    return LV_RESULT_OK;
+}
+
+/**
+ * Decompress the next row block intersecting `full_area` into the `decoded_partial` draw buffer.
+ * The blocks are always decoded in full width.
+ */
+static lv_result_t get_area_block_compressed(lv_image_decoder_dsc_t * dsc, const lv_area_t * full_area,
+                                             lv_area_t * decoded_area)
+{
+    decoder_data_t * decoder_data = dsc->user_data;
+    if(decoder_data == NULL || decoder_data->block_offsets == NULL) {
+        LV_LOG_ERROR("Unexpected null decoder data");
+        return LV_RESULT_INVALID;
+    }
+
+    const lv_image_dsc_t * image = dsc->src;
+    const lv_image_block_index_t * index = &decoder_data->block_index;
+    const uint8_t * offsets = decoder_data->block_offsets;
+    const uint8_t * blocks = offsets + (index->block_cnt + 1) * sizeof(uint32_t);
+    lv_color_format_t cf = dsc->header.cf;
+    uint32_t stride = dsc->header.stride;
+
+    int32_t block_y1;
+    if(decoded_area->y1 == LV_COORD_MIN) block_y1 = (full_area->y1 / index->block_h) * index->block_h;
+    else block_y1 = decoded_area->y2 + 1;
+
+    if(block_y1 > full_area->y2 || block_y1 >= dsc->header.h) return LV_RESULT_INVALID;
+
+    int32_t block_rows = LV_MIN(index->block_h, dsc->header.h - block_y1);
+
+    lv_draw_buf_t * decoded = decoder_data->decoded_partial;
+    if(decoded == NULL) {
+        decoded = lv_draw_buf_create_ex(image_cache_draw_buf_handlers, dsc->header.w, index->block_h, cf, stride);
+        if(decoded == NULL) {
+            LV_LOG_WARN("No memory for a block of %" LV_PRId32 " rows", (int32_t)index->block_h);
+            return LV_RESULT_INVALID;
+        }
+        decoder_data->decoded_partial = decoded; /*Free on decoder close*/
+    }
+
+    /*The last block can be shorter*/
+    if(lv_draw_buf_reshape(decoded, cf, dsc->header.w, block_rows, stride) == NULL) return LV_RESULT_INVALID;
+
+    uint32_t out_len = stride * block_rows;
+    if(cf == LV_COLOR_FORMAT_RGB565A8) out_len += (stride / 2) * block_rows;
+
+    uint32_t block_idx = block_y1 / index->block_h;
+    uint32_t block_start = get_block_offset(offsets, block_idx);
+    const uint8_t * input = blocks + block_start;
+    uint32_t input_len = get_block_offset(offsets, block_idx + 1) - block_start;
+    uint32_t len = 0;
+
+    if(((const lv_image_compressed_t *)image->data)->method == LV_IMAGE_COMPRESS_RLE_BLOCKS) {
+#if LV_USE_RLE
+        /*Same as for the not block compressed images*/
+        uint32_t pixel_byte;
+        if(cf == LV_COLOR_FORMAT_RGB565A8) pixel_byte = 2;
+        else pixel_byte = (lv_color_format_get_bpp(cf) + 7) >> 3;
+
+        len = lv_rle_decompress(input, input_len, decoded->data, out_len, pixel_byte);
+#endif /* LV_USE_RLE */
+    }
+    else {
+#if LV_USE_LZ4
+        int ret = LZ4_decompress_safe((const char *)input, (char *)decoded->data, (int)input_len, (int)out_len);
+        if(ret >= 0) len = (uint32_t)ret;
+#endif /* LV_USE_LZ4 */
+    }
+
+    if(len != out_len) {
+        LV_LOG_WARN("Decompress failed: %" LV_PRIu32 ", got: %" LV_PRIu32, out_len, len);
+        return LV_RESULT_INVALID;
+    }
+
+    decoded_area->x1 = 0;
+    decoded_area->x2 = dsc->header.w - 1;
+    decoded_area->y1 = block_y1;
+    decoded_area->y2 = block_y1 + block_rows - 1;
+
+    dsc->decoded = decoded; /*Return decoded image*/
+    return LV_RESULT_OK;
+}
+
+static uint32_t get_block_offset(const uint8_t * offsets, uint32_t idx)
+{
+    uint32_t offset;
+    lv_memcpy(&offset, offsets + idx * sizeof(uint32_t), sizeof(offset));
+    return offset;
+}
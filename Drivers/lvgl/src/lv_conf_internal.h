@@ -203,6 +203,18 @@
         #endif
     #endif
 
+    /** Size of a second memory pool for large buffers in bytes: draw buffers, decoded images and layers (0: unused).
+     *  This way the `LV_MEM_SIZE` pool can be in a small but fast memory for widgets and styles,
+     *  and the large buffers can be in a larger RAM. If one of the pools is full the other one is used too.
+     *  More pools can be added by `lv_mem_add_region_pool()`. */
+    #ifndef LV_MEM_LARGE_SIZE
+        #ifdef CONFIG_LV_MEM_LARGE_SIZE
+            #define LV_MEM_LARGE_SIZE CONFIG_LV_MEM_LARGE_SIZE
+        #else
+            #define LV_MEM_LARGE_SIZE 0
+        #endif
+    #endif
+
     /** Set an address for the memory pool instead of allocating it as a normal array. Can be in external SRAM too. */
     #ifndef LV_MEM_ADR
         #ifdef CONFIG_LV_MEM_ADR
@@ -243,6 +255,17 @@
     #endif
 #endif
 
+/** Keep the running timers in a binary heap ordered by their next run.
+ *  `lv_timer_handler()` visits only the due timers instead of all of them,
+ *  and creating or deleting timers in a timer callback doesn't restart the iteration. */
+#ifndef LV_USE_TIMER_HEAP
+    #ifdef CONFIG_LV_USE_TIMER_HEAP
+        #define LV_USE_TIMER_HEAP CONFIG_LV_USE_TIMER_HEAP
+    #else
+        #define LV_USE_TIMER_HEAP 0
+    #endif
+#endif
+
 /** Default Dots Per Inch. Used to initialize default sizes such as widgets sized, style paddings.
  * (Not so important, you can adjust it to modify default sizes and spaces.) */
 #ifndef LV_DPI_DEF
@@ -253,6 +276,47 @@
     #endif
 #endif
 
+/** When the `LV_INV_BUF_SIZE` long list of invalidated areas overflows, collect the areas
+ *  in a bit-per-tile dirty map instead of redrawing the whole screen.
+ *  The dirty tiles are merged into rectangles at refresh time. (Not used in `LV_DISPLAY_RENDER_MODE_FULL`) */
+#ifndef LV_USE_REFR_TILE_MAP
+    #ifdef CONFIG_LV_USE_REFR_TILE_MAP
+        #define LV_USE_REFR_TILE_MAP CONFIG_LV_USE_REFR_TILE_MAP
+    #else
+        #define LV_USE_REFR_TILE_MAP 0
+    #endif
+#endif
+#if LV_USE_REFR_TILE_MAP
+    /** Width and height of a tile in pixels. 8, 16 or 32 */
+    #ifndef LV_REFR_TILE_MAP_TILE_SIZE
+        #ifdef CONFIG_LV_REFR_TILE_MAP_TILE_SIZE
+            #define LV_REFR_TILE_MAP_TILE_SIZE CONFIG_LV_REFR_TILE_MAP_TILE_SIZE
+        #else
+            #define LV_REFR_TILE_MAP_TILE_SIZE 16
+        #endif
+    #endif
+#endif
+
+/** Before rendering a band collect the areas fully covered by opaque widgets
+ *  and skip drawing the widgets (or their main part) which are hidden by them. */
+#ifndef LV_USE_REFR_OCCLUSION
+    #ifdef CONFIG_LV_USE_REFR_OCCLUSION
+        #define LV_USE_REFR_OCCLUSION CONFIG_LV_USE_REFR_OCCLUSION
+    #else
+        #define LV_USE_REFR_OCCLUSION 0
+    #endif
+#endif
+#if LV_USE_REFR_OCCLUSION
+    /** Maximum number of opaque areas collected per band */
+    #ifndef LV_REFR_OCCLUSION_MAX
+        #ifdef CONFIG_LV_REFR_OCCLUSION_MAX
+            #define LV_REFR_OCCLUSION_MAX CONFIG_LV_REFR_OCCLUSION_MAX
+        #else
+            #define LV_REFR_OCCLUSION_MAX 16
+        #endif
+    #endif
+#endif
+
 /*=================
  * OPERATING SYSTEM
  *=================*/
@@ -366,6 +430,30 @@
     #endif
 #endif
 
+/* Allocate the layer buffers from a bump allocator instead of `lv_malloc()`.
+ * The arena is reset when all of its layers are drawn, so it needs no freeing and doesn't fragment.
+ * If a layer doesn't fit into the arena it's allocated by `lv_draw_buf_create()`.
+ * Use `LV_ATTRIBUTE_DRAW_LAYER_ARENA` to place it into a given RAM. 0: disable the arena */
+#ifndef LV_DRAW_LAYER_ARENA_SIZE
+    #ifdef CONFIG_LV_DRAW_LAYER_ARENA_SIZE
+        #define LV_DRAW_LAYER_ARENA_SIZE CONFIG_LV_DRAW_LAYER_ARENA_SIZE
+    #else
+        #define LV_DRAW_LAYER_ARENA_SIZE 0
+    #endif
+#endif
+
+/* Keep the draw tasks of a layer until it's drawn and optimize them in one pass before dispatching:
+ * touching opaque fills with the same color are merged, tasks covered by a later opaque fill are dropped and
+ * independent tasks of the same type are moved next to each other. The output doesn't change.
+ * The tasks are kept in memory longer, so at most this many tasks are collected before drawing them. 0: disable */
+#ifndef LV_DRAW_OPTIMIZE_TASKS
+    #ifdef CONFIG_LV_DRAW_OPTIMIZE_TASKS
+        #define LV_DRAW_OPTIMIZE_TASKS CONFIG_LV_DRAW_OPTIMIZE_TASKS
+    #else
+        #define LV_DRAW_OPTIMIZE_TASKS 0
+    #endif
+#endif
+
 /** Stack size of drawing thread.
  * NOTE: If FreeType or ThorVG is enabled, it is recommended to set it to 32KB or more.
  */
@@ -593,7 +681,9 @@
     #if LV_DRAW_SW_COMPLEX == 1
         /** Allow buffering some shadow calculation.
          *  LV_DRAW_SW_SHADOW_CACHE_SIZE is the maximum shadow size to buffer, where shadow size is
-         *  `shadow_width + radius`.  Caching has LV_DRAW_SW_SHADOW_CACHE_SIZE^2 RAM cost. */
+         *  `shadow_width + radius`.  Caching a shadow has `shadow size`^2 RAM cost.
+         *  The blurred corners of the recently used shadows are kept until they use
+         *  LV_DRAW_SW_SHADOW_CACHE_MEMORY bytes, then the least recently used ones are dropped. */
         #ifndef LV_DRAW_SW_SHADOW_CACHE_SIZE
             #ifdef CONFIG_LV_DRAW_SW_SHADOW_CACHE_SIZE
                 #define LV_DRAW_SW_SHADOW_CACHE_SIZE CONFIG_LV_DRAW_SW_SHADOW_CACHE_SIZE
@@ -602,6 +692,15 @@
             #endif
         #endif
 
+        /** Max memory for the cached shadow corners [bytes] */
+        #ifndef LV_DRAW_SW_SHADOW_CACHE_MEMORY
+            #ifdef CONFIG_LV_DRAW_SW_SHADOW_CACHE_MEMORY
+                #define LV_DRAW_SW_SHADOW_CACHE_MEMORY CONFIG_LV_DRAW_SW_SHADOW_CACHE_MEMORY
+            #else
+                #define LV_DRAW_SW_SHADOW_CACHE_MEMORY (LV_DRAW_SW_SHADOW_CACHE_SIZE * LV_DRAW_SW_SHADOW_CACHE_SIZE)
+            #endif
+        #endif
+
         /** Set number of maximally-cached circle data.
          *  The circumference of 1/4 circle are saved for anti-aliasing.
          *  `radius * 4` bytes are used per circle (the most often used radiuses are saved).
@@ -642,6 +741,36 @@
         #endif
     #endif
 
+    /** Rotate RGB565 and RGB565A8 images with a dedicated renderer which steps the image coordinates incrementally
+     *  and skips the pixels which are out of the image. */
+    #ifndef LV_DRAW_SW_TRANSFORM_FAST_RGB565
+        #ifdef CONFIG_LV_DRAW_SW_TRANSFORM_FAST_RGB565
+            #define LV_DRAW_SW_TRANSFORM_FAST_RGB565 CONFIG_LV_DRAW_SW_TRANSFORM_FAST_RGB565
+        #else
+            #define LV_DRAW_SW_TRANSFORM_FAST_RGB565    0
+        #endif
+    #endif
+
+    /** Draw the arcs row by row in parts. The hole of the ring and the parts out of the angle range
+     *  are skipped without calculating their masks. */
+    #ifndef LV_DRAW_SW_ARC_SPANS
+        #ifdef CONFIG_LV_DRAW_SW_ARC_SPANS
+            #define LV_DRAW_SW_ARC_SPANS CONFIG_LV_DRAW_SW_ARC_SPANS
+        #else
+            #define LV_DRAW_SW_ARC_SPANS    0
+        #endif
+    #endif
+
+    /** Draw the lines of charts and line widgets with one draw task per polyline instead of one task per segment.
+     *  The joints of opaque lines wider than 2 px are rounded. Not used if the widget sends draw task events. */
+    #ifndef LV_DRAW_SW_POLYLINE
+        #ifdef CONFIG_LV_DRAW_SW_POLYLINE
+            #define LV_DRAW_SW_POLYLINE CONFIG_LV_DRAW_SW_POLYLINE
+        #else
+            #define LV_DRAW_SW_POLYLINE     0
+        #endif
+    #endif
+
 #endif
 
 /*Use TSi's aka (Think Silicon) NemaGFX */
@@ -1339,6 +1468,18 @@
     #endif
 #endif
 
+/** Default number of images whose alpha channel analysis is cached.
+ *  RGB565A8 and ARGB8888 images are split into tiles which are marked as fully opaque, fully transparent or mixed
+ *  when the image is opened first. Opaque tiles are copied without blending and transparent tiles are skipped.
+ *  Only constant images are analyzed (not `LV_IMAGE_FLAGS_MODIFIABLE`). 0 to disable. */
+#ifndef LV_IMAGE_ALPHA_CACHE_DEF_CNT
+    #ifdef CONFIG_LV_IMAGE_ALPHA_CACHE_DEF_CNT
+        #define LV_IMAGE_ALPHA_CACHE_DEF_CNT CONFIG_LV_IMAGE_ALPHA_CACHE_DEF_CNT
+    #else
+        #define LV_IMAGE_ALPHA_CACHE_DEF_CNT 0
+    #endif
+#endif
+
 /** Number of stops allowed per gradient. Increase this to allow more stops.
  *  This adds (sizeof(lv_color_t) + 1) bytes per additional stop. */
 #ifndef LV_GRADIENT_MAX_STOPS
@@ -1372,6 +1513,17 @@
     #endif
 #endif
 
+/** Number of lines in the cache of the resolved style properties used while drawing (power of 2, 0: disable).
+ *  A line stores the values of 32 frequently used properties of a part of a widget in its current state.
+ *  Adds a 32-bit variable to each `lv_obj_t`. About 150 bytes per line on 32-bit MCUs. */
+#ifndef LV_OBJ_STYLE_RESOLVED_CACHE_LINES
+    #ifdef CONFIG_LV_OBJ_STYLE_RESOLVED_CACHE_LINES
+        #define LV_OBJ_STYLE_RESOLVED_CACHE_LINES CONFIG_LV_OBJ_STYLE_RESOLVED_CACHE_LINES
+    #else
+        #define LV_OBJ_STYLE_RESOLVED_CACHE_LINES   0
+    #endif
+#endif
+
 /** Add `id` field to `lv_obj_t` */
 #ifndef LV_USE_OBJ_ID
     #ifdef CONFIG_LV_USE_OBJ_ID
@@ -1601,6 +1753,24 @@
     #endif
 #endif
 
+/** Compiler prefix for the `LV_MEM_LARGE_SIZE` memory pool, e.g. to place it in a linker section */
+#ifndef LV_ATTRIBUTE_MEM_LARGE
+    #ifdef CONFIG_LV_ATTRIBUTE_MEM_LARGE
+        #define LV_ATTRIBUTE_MEM_LARGE CONFIG_LV_ATTRIBUTE_MEM_LARGE
+    #else
+        #define LV_ATTRIBUTE_MEM_LARGE
+    #endif
+#endif
+
+/** Compiler prefix for the `LV_DRAW_LAYER_ARENA_SIZE` layer buffer arena */
+#ifndef LV_ATTRIBUTE_DRAW_LAYER_ARENA
+    #ifdef CONFIG_LV_ATTRIBUTE_DRAW_LAYER_ARENA
+        #define LV_ATTRIBUTE_DRAW_LAYER_ARENA CONFIG_LV_ATTRIBUTE_DRAW_LAYER_ARENA
+    #else
+        #define LV_ATTRIBUTE_DRAW_LAYER_ARENA
+    #endif
+#endif
+
 /** Place performance critical functions into a faster memory (e.g RAM) */
 #ifndef LV_ATTRIBUTE_FAST_MEM
     #ifdef CONFIG_LV_ATTRIBUTE_FAST_MEM
@@ -1923,6 +2093,28 @@
     #endif
 #endif
 
+/** Number of entries in the direct-mapped cache of the code point -> glyph ID lookups of built-in fonts.
+ *  Speeds up fonts with many or sparse character maps (e.g. CJK fonts) where every lookup needs a binary search.
+ *  Must be a power of 2. 0: disable the cache. */
+#ifndef LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE
+    #ifdef CONFIG_LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE
+        #define LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE CONFIG_LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE
+    #else
+        #define LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE 0
+    #endif
+#endif
+
+/** Size of the cache of the rendered A8 bitmaps of built-in and binary font glyphs [bytes].
+ *  Labels drawn in multiple bands and redrawn texts don't need to decompress or convert the glyphs again.
+ *  0: disable the cache. */
+#ifndef LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+    #ifdef CONFIG_LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+        #define LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE CONFIG_LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+    #else
+        #define LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE 0
+    #endif
+#endif
+
 /** Enable drawing placeholders when glyph dsc is not found. */
 #ifndef LV_USE_FONT_PLACEHOLDER
     #ifdef LV_KCONFIG_PRESENT
@@ -2333,6 +2525,13 @@
             #define LV_LABEL_WAIT_CHAR_COUNT 3  /**< The count of wait chart */
         #endif
     #endif
+    #ifndef LV_LABEL_LINE_CACHE
+        #ifdef CONFIG_LV_LABEL_LINE_CACHE
+            #define LV_LABEL_LINE_CACHE CONFIG_LV_LABEL_LINE_CACHE
+        #else
+            #define LV_LABEL_LINE_CACHE 0       /**< Store the line breaks and line widths of the text to not measure unchanged texts again */
+        #endif
+    #endif
 #endif
 
 #ifndef LV_USE_LED
@@ -2681,6 +2880,16 @@
     #endif
 #endif
 
+/** Keep track of the containers having descendants with invalid layout.
+ *  Updating the layout visits only these branches instead of every widget of the screen. */
+#ifndef LV_LAYOUT_DIRTY_SUBTREE
+    #ifdef CONFIG_LV_LAYOUT_DIRTY_SUBTREE
+        #define LV_LAYOUT_DIRTY_SUBTREE CONFIG_LV_LAYOUT_DIRTY_SUBTREE
+    #else
+        #define LV_LAYOUT_DIRTY_SUBTREE 0
+    #endif
+#endif
+
 /*====================
  * 3RD PARTS LIBRARIES
  *====================*/
@@ -3226,6 +3435,26 @@
     #endif
 #endif
 
+/** 1: Keep the rendered image of widgets marked with `lv_obj_set_render_cache()`
+ *  and blit it instead of redrawing the widget and its children. Requires `LV_USE_SNAPSHOT`. */
+#ifndef LV_USE_OBJ_RENDER_CACHE
+    #ifdef CONFIG_LV_USE_OBJ_RENDER_CACHE
+        #define LV_USE_OBJ_RENDER_CACHE CONFIG_LV_USE_OBJ_RENDER_CACHE
+    #else
+        #define LV_USE_OBJ_RENDER_CACHE 0
+    #endif
+#endif
+#if LV_USE_OBJ_RENDER_CACHE
+    /** Maximum memory used by the cached images. The least recently used ones are dropped first. */
+    #ifndef LV_OBJ_RENDER_CACHE_SIZE
+        #ifdef CONFIG_LV_OBJ_RENDER_CACHE_SIZE
+            #define LV_OBJ_RENDER_CACHE_SIZE CONFIG_LV_OBJ_RENDER_CACHE_SIZE
+        #else
+            #define LV_OBJ_RENDER_CACHE_SIZE (32 * 1024)   /**< [bytes] */
+        #endif
+    #endif
+#endif
+
 /** 1: Enable system monitor component */
 #ifndef LV_USE_SYSMON
     #ifdef CONFIG_LV_USE_SYSMON
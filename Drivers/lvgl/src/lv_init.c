@@ -13,6 +13,7 @@
 #include "draw/lv_draw_buf_private.h"
 #include "core/lv_refr_private.h"
 #include "core/lv_obj_style_private.h"
+#include "core/lv_obj_render_cache_private.h"
 #include "core/lv_group_private.h"
 #include "lv_init.h"
 #include "core/lv_global.h"
@@ -133,6 +134,10 @@ static inline void lv_global_init(lv_global_t * global)
 
     lv_ll_init(&(global->disp_ll), sizeof(lv_display_t));
     lv_ll_init(&(global->indev_ll), sizeof(lv_indev_t));
+    lv_ll_init(&(global->font_fmt_index_ll), sizeof(lv_font_fmt_txt_index_t));
+#if LV_USE_OBSERVER
+    lv_ll_init(&(global->subject_batch_ll), sizeof(void *)); /*Pointers to `lv_subject_t`*/
+#endif
 
     global->memory_zero = ZERO_MEM_SENTINEL;
     global->style_refresh = true;
@@ -145,11 +150,6 @@ static inline void lv_global_init(lv_global_t * global)
     void LV_LOG_PRINT_CB(lv_log_level_t, const char * txt);
     global->custom_log_print_cb = LV_LOG_PRINT_CB;
 #endif
-
-#if defined(LV_DRAW_SW_SHADOW_CACHE_SIZE) && LV_DRAW_SW_SHADOW_CACHE_SIZE > 0
-    global->sw_shadow_cache.cache_size = -1;
-    global->sw_shadow_cache.cache_r = -1;
-#endif
 }
 
 static inline void lv_cleanup_devices(lv_global_t * global)
@@ -288,6 +288,12 @@ void lv_init(void)
     lv_image_decoder_init(LV_CACHE_DEF_SIZE, LV_IMAGE_HEADER_CACHE_DEF_CNT);
     lv_bin_decoder_init();  /*LVGL built-in binary image decoder*/
 
+    lv_font_fmt_txt_glyph_cache_init(LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE);
+
+#if LV_USE_OBJ_RENDER_CACHE
+    lv_obj_render_cache_init();
+#endif
+
 #if LV_USE_DRAW_VG_LITE
     lv_draw_vg_lite_init();
 #endif
@@ -451,8 +457,19 @@ void lv_deinit(void)
     lv_theme_mono_deinit();
 #endif
 
+#if LV_USE_OBJ_RENDER_CACHE
+    lv_obj_render_cache_deinit();
+#endif
+
+#if LV_USE_OBSERVER
+    lv_ll_clear(&(LV_GLOBAL_DEFAULT()->subject_batch_ll));
+#endif
+
     lv_image_decoder_deinit();
 
+    lv_font_fmt_txt_glyph_cache_deinit();
+    lv_font_fmt_txt_index_deinit();
+
     lv_refr_deinit();
 
     lv_obj_style_deinit();
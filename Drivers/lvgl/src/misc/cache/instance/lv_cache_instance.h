@@ -11,6 +11,7 @@
  *********************/
 
 #include "lv_image_header_cache.h"
+#include "lv_image_alpha_cache.h"
 #include "lv_image_cache.h"
 
 #endif //LV_CACHE_INSTANCE_H
@@ -0,0 +1,128 @@
+/**
+* @file lv_image_alpha_cache.c
+*
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../../draw/lv_image_decoder_private.h"
+#include "../../lv_assert.h"
+#include "../../../core/lv_global.h"
+
+#include "lv_image_alpha_cache.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define CACHE_NAME  "IMAGE_ALPHA"
+
+#define img_alpha_cache_p (LV_GLOBAL_DEFAULT()->img_alpha_cache)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static lv_cache_compare_res_t image_alpha_cache_compare_cb(const lv_image_alpha_cache_data_t * lhs,
+                                                           const lv_image_alpha_cache_data_t * rhs);
+static void image_alpha_cache_free_cb(lv_image_alpha_cache_data_t * entry, void * user_data);
+
+/**********************
+ *  GLOBAL VARIABLES
+ **********************/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_result_t lv_image_alpha_cache_init(uint32_t count)
+{
+    if(img_alpha_cache_p != NULL) {
+        return LV_RESULT_OK;
+    }
+
+    img_alpha_cache_p = lv_cache_create(&lv_cache_class_lru_rb_count,
+    sizeof(lv_image_alpha_cache_data_t), count, (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t) image_alpha_cache_compare_cb,
+        .create_cb = NULL,
+        .free_cb = (lv_cache_free_cb_t) image_alpha_cache_free_cb
+    });
+
+    lv_cache_set_name(img_alpha_cache_p, CACHE_NAME);
+    return img_alpha_cache_p != NULL ? LV_RESULT_OK : LV_RESULT_INVALID;
+}
+
+void lv_image_alpha_cache_resize(uint32_t count, bool evict_now)
+{
+    lv_cache_set_max_size(img_alpha_cache_p, count, NULL);
+    if(evict_now) {
+        lv_cache_reserve(img_alpha_cache_p, count, NULL);
+    }
+}
+
+void lv_image_alpha_cache_drop(const void * src)
+{
+    if(src == NULL) {
+        lv_cache_drop_all(img_alpha_cache_p, NULL);
+        return;
+    }
+
+    lv_image_alpha_cache_data_t search_key = {
+        .src = src,
+        .src_type = lv_image_src_get_type(src),
+    };
+
+    lv_cache_drop(img_alpha_cache_p, &search_key, NULL);
+}
+
+bool lv_image_alpha_cache_is_enabled(void)
+{
+    return lv_cache_is_enabled(img_alpha_cache_p);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static lv_cache_compare_res_t image_alpha_cache_compare_cb(
+    const lv_image_alpha_cache_data_t * lhs,
+    const lv_image_alpha_cache_data_t * rhs)
+{
+    if(lhs->src_type == rhs->src_type) {
+        if(lhs->src_type == LV_IMAGE_SRC_FILE) {
+            int32_t cmp_res = lv_strcmp(lhs->src, rhs->src);
+            if(cmp_res != 0) {
+                return cmp_res > 0 ? 1 : -1;
+            }
+        }
+        else if(lhs->src_type == LV_IMAGE_SRC_VARIABLE) {
+            if(lhs->src != rhs->src) {
+                return lhs->src > rhs->src ? 1 : -1;
+            }
+        }
+        return 0;
+    }
+    return lhs->src_type > rhs->src_type ? 1 : -1;
+}
+
+static void image_alpha_cache_free_cb(lv_image_alpha_cache_data_t * entry, void * user_data)
+{
+    LV_UNUSED(user_data); /*Unused*/
+
+    lv_free(entry->map.tiles);
+    if(entry->src_type == LV_IMAGE_SRC_FILE) lv_free((void *)entry->src);
+}
@@ -0,0 +1,72 @@
+/**
+* @file lv_image_alpha_cache.h
+*
+ */
+
+#ifndef LV_IMAGE_ALPHA_CACHE_H
+#define LV_IMAGE_ALPHA_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../lv_types.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Initialize the image alpha cache. It stores which tiles of an image are fully opaque
+ * or fully transparent so that the alpha channel needs to be analyzed only once.
+ * @param  count initial size of the cache in count of images.
+ * @return LV_RESULT_OK: initialization succeeded, LV_RESULT_INVALID: failed.
+ */
+lv_result_t lv_image_alpha_cache_init(uint32_t count);
+
+/**
+ * Resize image alpha cache.
+ * If set to 0, the cache is disabled.
+ * @param count  new max count of cached alpha maps.
+ * @param evict_now true: evict the alpha maps should be removed by the eviction policy, false: wait for the next cache cleanup.
+ */
+void lv_image_alpha_cache_resize(uint32_t count, bool evict_now);
+
+/**
+ * Invalidate image alpha cache. Use NULL to invalidate all alpha maps.
+ * It's also automatically called when an image is invalidated.
+ * @param src pointer to an image source.
+ */
+void lv_image_alpha_cache_drop(const void * src);
+
+/**
+ * Return true if the image alpha cache is enabled.
+ * @return true: enabled, false: disabled.
+ */
+bool lv_image_alpha_cache_is_enabled(void);
+
+/*************************
+ *    GLOBAL VARIABLES
+ *************************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_IMAGE_ALPHA_CACHE_H*/
@@ -24,6 +24,8 @@
 #define state LV_GLOBAL_DEFAULT()->timer_state
 #define timer_ll_p &(state.timer_ll)
 
+#define HEAP_INDEX_NONE UINT32_MAX
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -34,6 +36,15 @@
 static bool lv_timer_exec(lv_timer_t * timer);
 static uint32_t lv_timer_time_remaining(lv_timer_t * timer);
 static void lv_timer_handler_resume(void);
+#if LV_USE_TIMER_HEAP
+    static uint32_t lv_timer_handler_heap(void);
+    static bool heap_reserve(uint32_t cnt);
+    static void heap_insert(lv_timer_t * timer);
+    static void heap_remove(lv_timer_t * timer);
+    static void heap_update(lv_timer_t * timer);
+    static void heap_sift_up(uint32_t i);
+    static void heap_sift_down(uint32_t i);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -55,6 +66,12 @@ static void lv_timer_handler_resume(void);
 void lv_timer_core_init(void)
 {
     lv_ll_init(timer_ll_p, sizeof(lv_timer_t));
+#if LV_USE_TIMER_HEAP
+    state.heap = NULL;
+    state.heap_cnt = 0;
+    state.heap_size = 0;
+    state.timer_cnt = 0;
+#endif
 
     /*Initially enable the lv_timer handling*/
     lv_timer_enable(true);
@@ -90,6 +107,9 @@ LV_ATTRIBUTE_TIMER_HANDLER uint32_t lv_timer_handler(void)
         }
     }
 
+#if LV_USE_TIMER_HEAP
+    uint32_t time_until_next = lv_timer_handler_heap();
+#else
     /*Run all timer from the list*/
     lv_timer_t * next;
     lv_timer_t * timer_active;
@@ -127,6 +147,7 @@ LV_ATTRIBUTE_TIMER_HANDLER uint32_t lv_timer_handler(void)
 
         next = lv_ll_get_next(timer_head, next); /*Find the next timer*/
     }
+#endif
 
     state_p->busy_time += lv_tick_elaps(handler_start);
     uint32_t idle_period_time = lv_tick_elaps(state_p->idle_period_start);
@@ -178,6 +199,19 @@ lv_timer_t * lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void * us
     new_timer->user_data = user_data;
     new_timer->auto_delete = true;
 
+#if LV_USE_TIMER_HEAP
+    /*Allocate a heap slot for every timer, so resuming a paused one can't fail*/
+    if(!heap_reserve(state.timer_cnt + 1)) {
+        lv_ll_remove(timer_ll_p, new_timer);
+        lv_free(new_timer);
+        return NULL;
+    }
+    state.timer_cnt++;
+    new_timer->run_id = state.run_id - 1;
+    new_timer->heap_index = HEAP_INDEX_NONE;
+    heap_insert(new_timer);
+#endif
+
     state.timer_created = true;
 
     lv_timer_handler_resume();
@@ -193,6 +227,10 @@ void lv_timer_set_cb(lv_timer_t * timer, lv_timer_cb_t timer_cb)
 
 void lv_timer_delete(lv_timer_t * timer)
 {
+#if LV_USE_TIMER_HEAP
+    heap_remove(timer);
+    state.timer_cnt--;
+#endif
     lv_ll_remove(timer_ll_p, timer);
     state.timer_deleted = true;
 
@@ -203,12 +241,18 @@ void lv_timer_pause(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->paused = true;
+#if LV_USE_TIMER_HEAP
+    heap_remove(timer);
+#endif
 }
 
 void lv_timer_resume(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->paused = false;
+#if LV_USE_TIMER_HEAP
+    if(timer->heap_index == HEAP_INDEX_NONE) heap_insert(timer);
+#endif
     lv_timer_handler_resume();
 }
 
@@ -216,18 +260,27 @@ void lv_timer_set_period(lv_timer_t * timer, uint32_t period)
 {
     LV_ASSERT_NULL(timer);
     timer->period = period;
+#if LV_USE_TIMER_HEAP
+    heap_update(timer);
+#endif
 }
 
 void lv_timer_ready(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->last_run = lv_tick_get() - timer->period - 1;
+#if LV_USE_TIMER_HEAP
+    heap_update(timer);
+#endif
 }
 
 void lv_timer_set_repeat_count(lv_timer_t * timer, int32_t repeat_count)
 {
     LV_ASSERT_NULL(timer);
     timer->repeat_count = repeat_count;
+#if LV_USE_TIMER_HEAP
+    heap_update(timer);
+#endif
 }
 
 void lv_timer_set_auto_delete(lv_timer_t * timer, bool auto_delete)
@@ -246,6 +299,9 @@ void lv_timer_reset(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->last_run = lv_tick_get();
+#if LV_USE_TIMER_HEAP
+    heap_update(timer);
+#endif
     lv_timer_handler_resume();
 }
 
@@ -260,6 +316,13 @@ void lv_timer_core_deinit(void)
     lv_timer_enable(false);
 
     lv_ll_clear(timer_ll_p);
+#if LV_USE_TIMER_HEAP
+    lv_free(state.heap);
+    state.heap = NULL;
+    state.heap_cnt = 0;
+    state.heap_size = 0;
+    state.timer_cnt = 0;
+#endif
 }
 
 uint32_t lv_timer_get_idle(void)
@@ -320,6 +383,9 @@ static bool lv_timer_exec(lv_timer_t * timer)
         int32_t original_repeat_count = timer->repeat_count;
         if(timer->repeat_count > 0) timer->repeat_count--;
         timer->last_run = lv_tick_get();
+#if LV_USE_TIMER_HEAP
+        heap_update(timer);
+#endif
         LV_TRACE_TIMER("calling timer callback: %p", *((void **)&timer->timer_cb));
 
         if(timer->timer_cb && original_repeat_count != 0) {
@@ -381,6 +447,157 @@ static void lv_timer_handler_resume(void)
     }
 }
 
+#if LV_USE_TIMER_HEAP
+
+/**
+ * Run the due timers in the order of their next run.
+ * A timer's position is updated when it runs or changes, so creating or deleting timers
+ * in the callbacks doesn't require starting again.
+ * @return the time until the next timer is due
+ */
+static uint32_t lv_timer_handler_heap(void)
+{
+    state.run_id++;
+
+    while(state.heap_cnt > 0) {
+        lv_timer_t * timer = state.heap[0];
+
+        /*Every timer runs at most once per call, even with 0 period.
+         *The timers which have already run are behind the others with the same deadline.*/
+        if(timer->run_id == state.run_id) break;
+
+        /*The timers with an over repeat count are in front to be deleted or paused even if not due*/
+        if(timer->repeat_count != 0 && lv_timer_time_remaining(timer) != 0) break;
+
+        timer->run_id = state.run_id;
+        state.timer_deleted = false;
+        if(!lv_timer_exec(timer)) {
+            /*Not executed, the timer had to be deleted or paused but keep the loop finite anyway*/
+            if(!state.timer_deleted && timer->heap_index != HEAP_INDEX_NONE) heap_sift_down(timer->heap_index);
+        }
+    }
+
+    if(state.heap_cnt == 0) return LV_NO_TIMER_READY;
+
+    lv_timer_t * first = state.heap[0];
+    if(first->repeat_count == 0) return 0;
+    return lv_timer_time_remaining(first);
+}
+
+/**
+ * Tell if timer `a` should run before timer `b`
+ */
+static inline bool heap_less(const lv_timer_t * a, const lv_timer_t * b)
+{
+    /*The ticks overflow, so compare the difference*/
+    int32_t diff = (int32_t)(a->deadline - b->deadline);
+    if(diff != 0) return diff < 0;
+
+    return a->run_id != state.run_id && b->run_id == state.run_id;
+}
+
+static inline void heap_set(uint32_t i, lv_timer_t * timer)
+{
+    state.heap[i] = timer;
+    timer->heap_index = i;
+}
+
+static void heap_sift_up(uint32_t i)
+{
+    lv_timer_t * timer = state.heap[i];
+    while(i > 0) {
+        uint32_t parent = (i - 1) / 2;
+        if(!heap_less(timer, state.heap[parent])) break;
+        heap_set(i, state.heap[parent]);
+        i = parent;
+    }
+    heap_set(i, timer);
+}
+
+static void heap_sift_down(uint32_t i)
+{
+    lv_timer_t * timer = state.heap[i];
+    while(1) {
+        uint32_t child = i * 2 + 1;
+        if(child >= state.heap_cnt) break;
+        if(child + 1 < state.heap_cnt && heap_less(state.heap[child + 1], state.heap[child])) child++;
+        if(!heap_less(state.heap[child], timer)) break;
+        heap_set(i, state.heap[child]);
+        i = child;
+    }
+    heap_set(i, timer);
+}
+
+/**
+ * Make room for `cnt` timers in the heap
+ * @return false if the memory couldn't be allocated
+ */
+static bool heap_reserve(uint32_t cnt)
+{
+    if(cnt <= state.heap_size) return true;
+
+    uint32_t new_size = state.heap_size ? state.heap_size * 2 : 16;
+    while(new_size < cnt) new_size *= 2;
+
+    lv_timer_t ** new_heap = lv_realloc(state.heap, new_size * sizeof(lv_timer_t *));
+    LV_ASSERT_MALLOC(new_heap);
+    if(new_heap == NULL) return false;
+
+    state.heap = new_heap;
+    state.heap_size = new_size;
+    return true;
+}
+
+/**
+ * Get the key of a timer in the heap.
+ * A timer with an over repeat count is due at once to be deleted or paused.
+ */
+static uint32_t heap_get_deadline(const lv_timer_t * timer)
+{
+    if(timer->repeat_count == 0) return timer->last_run;
+
+    /*Keep the deadlines comparable by their difference*/
+    return timer->last_run + LV_MIN(timer->period, (uint32_t)INT32_MAX);
+}
+
+static void heap_insert(lv_timer_t * timer)
+{
+    timer->deadline = heap_get_deadline(timer);
+    heap_set(state.heap_cnt, timer);
+    state.heap_cnt++;
+    heap_sift_up(timer->heap_index);
+}
+
+static void heap_remove(lv_timer_t * timer)
+{
+    uint32_t i = timer->heap_index;
+    if(i == HEAP_INDEX_NONE) return;
+
+    timer->heap_index = HEAP_INDEX_NONE;
+    state.heap_cnt--;
+    if(i == state.heap_cnt) return;
+
+    /*Move the last timer to the free slot*/
+    lv_timer_t * moved = state.heap[state.heap_cnt];
+    heap_set(i, moved);
+    heap_sift_up(i);
+    heap_sift_down(moved->heap_index);
+}
+
+/**
+ * Move a timer to its place after its deadline has changed
+ */
+static void heap_update(lv_timer_t * timer)
+{
+    if(timer->heap_index == HEAP_INDEX_NONE) return;
+
+    timer->deadline = heap_get_deadline(timer);
+    heap_sift_up(timer->heap_index);
+    heap_sift_down(timer->heap_index);
+}
+
+#endif /*LV_USE_TIMER_HEAP*/
+
 void lv_timer_handler_set_resume_cb(lv_timer_handler_resume_cb_t cb, void * data)
 {
     state.resume_cb = cb;
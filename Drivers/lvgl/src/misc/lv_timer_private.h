@@ -35,10 +35,22 @@ struct _lv_timer_t {
     int32_t repeat_count;      /**< 1: One time;  -1 : infinity;  n>0: residual times */
     uint32_t paused : 1;
     uint32_t auto_delete : 1;
+#if LV_USE_TIMER_HEAP
+    uint32_t deadline;         /**< Tick of the next run, the key in the timer heap */
+    uint32_t heap_index;       /**< Index in the timer heap or `UINT32_MAX` if it's not in the heap (paused) */
+    uint32_t run_id;           /**< `run_id` of the `lv_timer_handler()` call which ran the timer last */
+#endif
 };
 
 typedef struct {
     lv_ll_t timer_ll;          /**< Linked list to store the lv_timers */
+#if LV_USE_TIMER_HEAP
+    lv_timer_t ** heap;        /**< Binary min-heap of the not paused timers ordered by `deadline` */
+    uint32_t heap_cnt;         /**< Number of timers in the heap */
+    uint32_t heap_size;        /**< Allocated slots, at least the number of timers */
+    uint32_t timer_cnt;        /**< Number of timers, paused ones included */
+    uint32_t run_id;           /**< Incremented by every `lv_timer_handler()` call */
+#endif
 
     bool lv_timer_run;
     uint8_t idle_last;
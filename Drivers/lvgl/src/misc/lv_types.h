@@ -173,10 +173,14 @@ typedef struct _lv_image_cache_data_t lv_image_cache_data_t;
 
 typedef struct _lv_image_header_cache_data_t lv_image_header_cache_data_t;
 
+typedef struct _lv_image_alpha_cache_data_t lv_image_alpha_cache_data_t;
+
 typedef struct _lv_draw_mask_t lv_draw_mask_t;
 
 typedef struct _lv_draw_label_hint_t lv_draw_label_hint_t;
 
+typedef struct _lv_draw_label_line_cache_t lv_draw_label_line_cache_t;
+
 typedef struct _lv_draw_glyph_dsc_t lv_draw_glyph_dsc_t;
 
 typedef struct _lv_draw_image_sup_t lv_draw_image_sup_t;
@@ -13,10 +13,13 @@
 #include "../../lvgl.h"
 #include "../../core/lv_obj_private.h"
 #include "../../misc/lv_event_private.h"
+#include "../../misc/lv_text_private.h"
+#include "../../core/lv_global.h"
 
 /*********************
  *      DEFINES
  *********************/
+#define subject_batch_ll_p &(LV_GLOBAL_DEFAULT()->subject_batch_ll)
 
 /**********************
  *      TYPEDEFS
@@ -87,9 +90,13 @@ static void obj_state_observer_cb(lv_observer_t * observer, lv_subject_t * subje
 static void obj_value_changed_event_cb(lv_event_t * e);
 
 static void lv_subject_notify_if_changed(lv_subject_t * subject);
+static void notify_if_value_changed(lv_subject_t * subject);
+static void batch_add(lv_subject_t * subject);
+static void batch_remove(lv_subject_t * subject);
 
 #if LV_USE_LABEL
     static void label_text_observer_cb(lv_observer_t * observer, lv_subject_t * subject);
+    static void label_set_text_fmt_if_changed(lv_obj_t * obj, const char * fmt, ...) LV_FORMAT_ATTRIBUTE(2, 3);
 #endif
 
 #if LV_USE_ARC
@@ -143,7 +150,7 @@ void lv_subject_set_int(lv_subject_t * subject, int32_t value)
         return;
     }
 
-    subject->prev_value.num = subject->value.num;
+    if(!subject->batch_dirty) subject->prev_value.num = subject->value.num;
     subject->value.num = value;
     lv_subject_notify_if_changed(subject);
 }
@@ -186,7 +193,7 @@ void lv_subject_set_float(lv_subject_t * subject, float value)
         return;
     }
 
-    subject->prev_value.float_v = subject->value.float_v;
+    if(!subject->batch_dirty) subject->prev_value.float_v = subject->value.float_v;
     subject->value.float_v = value;
     lv_subject_notify_if_changed(subject);
 }
@@ -235,7 +242,7 @@ void lv_subject_copy_string(lv_subject_t * subject, const char * buf)
     }
 
     if(subject->size < 1) return;
-    if(subject->prev_value.pointer) {
+    if(subject->prev_value.pointer && !subject->batch_dirty) {
         lv_strlcpy((char *)subject->prev_value.pointer, subject->value.pointer, subject->size);
     }
 
@@ -253,7 +260,7 @@ void lv_subject_snprintf(lv_subject_t * subject, const char * format, ...)
 
     if(subject->size < 1U) return;
 
-    if(subject->prev_value.pointer) {
+    if(subject->prev_value.pointer && !subject->batch_dirty) {
         lv_strlcpy((char *)subject->prev_value.pointer, subject->value.pointer, subject->size);
     }
 
@@ -302,7 +309,7 @@ void lv_subject_set_pointer(lv_subject_t * subject, void * ptr)
         return;
     }
 
-    subject->prev_value.pointer = subject->value.pointer;
+    if(!subject->batch_dirty) subject->prev_value.pointer = subject->value.pointer;
     subject->value.pointer = ptr;
     lv_subject_notify_if_changed(subject);
 }
@@ -343,7 +350,7 @@ void lv_subject_set_color(lv_subject_t * subject, lv_color_t color)
         return;
     }
 
-    subject->prev_value.color = subject->value.color;
+    if(!subject->batch_dirty) subject->prev_value.color = subject->value.color;
     subject->value.color = color;
     lv_subject_notify_if_changed(subject);
 }
@@ -385,6 +392,8 @@ void lv_subject_init_group(lv_subject_t * group_subject, lv_subject_t * list[],
 
 void lv_subject_deinit(lv_subject_t * subject)
 {
+    if(subject->batch_dirty) batch_remove(subject);
+
     lv_observer_t * observer = lv_ll_get_head(&subject->subs_ll);
     while(observer) {
         lv_observer_t * observer_next = lv_ll_get_next(&subject->subs_ll, observer);
@@ -550,6 +559,47 @@ void lv_subject_notify(lv_subject_t * subject)
     } while(subject->notify_restart_query);
 }
 
+void lv_subject_set_batched(lv_subject_t * subject, bool en)
+{
+    LV_ASSERT_NULL(subject);
+
+    if(subject->batched == en) return;
+
+    subject->batched = en;
+    if(!en && subject->batch_dirty) {
+        batch_remove(subject);
+        notify_if_value_changed(subject);
+    }
+}
+
+bool lv_subject_get_batched(const lv_subject_t * subject)
+{
+    LV_ASSERT_NULL(subject);
+
+    return subject->batched;
+}
+
+void lv_subject_notify_batched(void)
+{
+    lv_ll_t * batch_ll = subject_batch_ll_p;
+    lv_subject_t ** subject_p = lv_ll_get_head(batch_ll);
+    if(subject_p == NULL) return;
+
+    LV_PROFILER_BEGIN;
+    /*Observers might set other batched Subjects which are added to the end of the list*/
+    while(subject_p) {
+        lv_subject_t * subject = *subject_p;
+        lv_ll_remove(batch_ll, subject_p);
+        lv_free(subject_p);
+
+        subject->batch_dirty = 0;
+        notify_if_value_changed(subject);
+
+        subject_p = lv_ll_get_head(batch_ll);
+    }
+    LV_PROFILER_END;
+}
+
 void lv_obj_add_subject_increment_event(lv_obj_t * obj, lv_subject_t * subject, lv_event_code_t trigger, int32_t step,
                                         int32_t min, int32_t max)
 {
@@ -1023,7 +1073,16 @@ static void obj_value_changed_event_cb(lv_event_t * e)
 
 static void lv_subject_notify_if_changed(lv_subject_t * subject)
 {
+    if(subject->batched) {
+        batch_add(subject);
+        return;
+    }
 
+    notify_if_value_changed(subject);
+}
+
+static void notify_if_value_changed(lv_subject_t * subject)
+{
     switch(subject->type) {
         case LV_SUBJECT_TYPE_INVALID :
         case LV_SUBJECT_TYPE_NONE :
@@ -1059,6 +1118,48 @@ static void lv_subject_notify_if_changed(lv_subject_t * subject)
     }
 }
 
+/**
+ * Mark a batched Subject as changed and make sure that a refresh is coming to notify its Observers
+ * @param subject   pointer to a batched Subject
+ */
+static void batch_add(lv_subject_t * subject)
+{
+    if(subject->batch_dirty) return;
+
+    lv_subject_t ** subject_p = lv_ll_ins_tail(subject_batch_ll_p);
+    LV_ASSERT_MALLOC(subject_p);
+    if(subject_p == NULL) {
+        notify_if_value_changed(subject);
+        return;
+    }
+
+    *subject_p = subject;
+    subject->batch_dirty = 1;
+
+    /*The refresh timers are paused if nothing is invalidated*/
+    lv_display_t * disp = lv_display_get_next(NULL);
+    while(disp) {
+        lv_timer_t * refr_timer = lv_display_get_refr_timer(disp);
+        if(refr_timer) lv_timer_resume(refr_timer);
+        disp = lv_display_get_next(disp);
+    }
+}
+
+static void batch_remove(lv_subject_t * subject)
+{
+    lv_ll_t * batch_ll = subject_batch_ll_p;
+    lv_subject_t ** subject_p;
+    LV_LL_READ(batch_ll, subject_p) {
+        if(*subject_p == subject) {
+            lv_ll_remove(batch_ll, subject_p);
+            lv_free(subject_p);
+            break;
+        }
+    }
+
+    subject->batch_dirty = 0;
+}
+
 #if LV_USE_LABEL
 
 static void label_text_observer_cb(lv_observer_t * observer, lv_subject_t * subject)
@@ -1066,21 +1167,25 @@ static void label_text_observer_cb(lv_observer_t * observer, lv_subject_t * subj
     const char * fmt = observer->user_data;
 
     if(fmt == NULL) {
-        lv_label_set_text(observer->target, subject->value.pointer);
+        /*Don't invalidate the label if the text is the same*/
+        const char * text = subject->value.pointer;
+        if(text == NULL || lv_strcmp(lv_label_get_text(observer->target), text) != 0) {
+            lv_label_set_text(observer->target, text);
+        }
     }
     else {
         switch(subject->type) {
             case LV_SUBJECT_TYPE_INT:
-                lv_label_set_text_fmt(observer->target, fmt, subject->value.num);
+                label_set_text_fmt_if_changed(observer->target, fmt, subject->value.num);
                 break;
 #if LV_USE_FLOAT
             case LV_SUBJECT_TYPE_FLOAT:
-                lv_label_set_text_fmt(observer->target, fmt, subject->value.float_v);
+                label_set_text_fmt_if_changed(observer->target, fmt, subject->value.float_v);
                 break;
 #endif
             case LV_SUBJECT_TYPE_STRING:
             case LV_SUBJECT_TYPE_POINTER:
-                lv_label_set_text_fmt(observer->target, fmt, subject->value.pointer);
+                label_set_text_fmt_if_changed(observer->target, fmt, subject->value.pointer);
                 break;
             default:
                 break;
@@ -1088,6 +1193,22 @@ static void label_text_observer_cb(lv_observer_t * observer, lv_subject_t * subj
     }
 }
 
+/**
+ * Set a formatted text only if it's different from the current text of the label
+ * to not invalidate the label needlessly.
+ */
+static void label_set_text_fmt_if_changed(lv_obj_t * obj, const char * fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    char * text = lv_text_set_text_vfmt(fmt, args);
+    va_end(args);
+    if(text == NULL) return;
+
+    if(lv_strcmp(lv_label_get_text(obj), text) != 0) lv_label_set_text(obj, text);
+    lv_free(text);
+}
+
 #endif /*LV_USE_LABEL*/
 
 #if LV_USE_ARC
@@ -63,6 +63,8 @@ typedef struct {
     uint32_t size                 : 24;  /**< String buffer size or group length */
     uint32_t notify_restart_query :  1;  /**< If an Observer was deleted during notification,
                                           * start notifying from the beginning. */
+    uint32_t batched              :  1;  /**< Notify the Observers only once before the next refresh */
+    uint32_t batch_dirty          :  1;  /**< The value has changed since the last batched notification */
 } lv_subject_t;
 
 /**
@@ -342,6 +344,32 @@ void * lv_observer_get_user_data(const lv_observer_t * observer);
  */
 void lv_subject_notify(lv_subject_t * subject);
 
+/**
+ * Enable or disable batched notifications of a Subject.
+ * In batched mode setting the value only stores it and the Observers are notified
+ * once, right before the next display refresh, with the latest value.
+ * If the value is the same as at the last notification the Observers are not notified.
+ * Useful for values which change much more frequently than the display is refreshed,
+ * e.g. sensor readings.
+ * @param subject       pointer to Subject
+ * @param en            true: enable batched mode; false: notify immediately on every change (default)
+ * @note                If there is a pending change when disabling batched mode, the Observers are notified immediately.
+ */
+void lv_subject_set_batched(lv_subject_t * subject, bool en);
+
+/**
+ * Tell whether a Subject notifies its Observers in batches.
+ * @param subject       pointer to Subject
+ * @return              true: batched mode is enabled
+ */
+bool lv_subject_get_batched(const lv_subject_t * subject);
+
+/**
+ * Notify the Observers of all batched Subjects whose value has changed.
+ * It's called automatically before each display refresh.
+ */
+void lv_subject_notify_batched(void);
+
 /**
  * Add an event handler to increment (or decrement) the value of a subject on a trigger.
  * @param obj       pointer to a widget
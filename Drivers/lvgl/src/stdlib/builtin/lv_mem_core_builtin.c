@@ -45,6 +45,12 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static lv_tlsf_pool_dsc_t * add_pool(lv_mem_region_t region, void * mem, size_t bytes);
+static lv_tlsf_pool_dsc_t * find_pool(const void * p);
+static void * region_malloc(size_t size, lv_mem_region_t region, bool other_regions);
+static void used_add(void * p);
+static void used_remove(lv_tlsf_pool_dsc_t * pool_dsc, size_t size);
+static void monitor_finish(lv_mem_monitor_t * mon_p);
 static void lv_mem_walker(void * ptr, size_t size, int used, void * user);
 
 /**********************
@@ -74,24 +80,24 @@ void lv_mem_init(void)
     lv_mutex_init(&state.mutex);
 #endif
 
+    lv_ll_init(&state.pool_ll, sizeof(lv_tlsf_pool_dsc_t));
+
 #if LV_MEM_ADR == 0
 #ifdef LV_MEM_POOL_ALLOC
-    state.tlsf = lv_tlsf_create_with_pool((void *)LV_MEM_POOL_ALLOC(LV_MEM_SIZE), LV_MEM_SIZE);
+    add_pool(LV_MEM_REGION_FAST, (void *)LV_MEM_POOL_ALLOC(LV_MEM_SIZE), LV_MEM_SIZE);
 #else
     /*Allocate a large array to store the dynamically allocated data*/
     static LV_ATTRIBUTE_LARGE_RAM_ARRAY MEM_UNIT work_mem_int[LV_MEM_SIZE / sizeof(MEM_UNIT)];
-    state.tlsf = lv_tlsf_create_with_pool((void *)work_mem_int, LV_MEM_SIZE);
+    add_pool(LV_MEM_REGION_FAST, (void *)work_mem_int, LV_MEM_SIZE);
 #endif
 #else
-    state.tlsf = lv_tlsf_create_with_pool((void *)LV_MEM_ADR, LV_MEM_SIZE);
+    add_pool(LV_MEM_REGION_FAST, (void *)LV_MEM_ADR, LV_MEM_SIZE);
 #endif
 
-    lv_ll_init(&state.pool_ll, sizeof(lv_pool_t));
-
-    /*Record the first pool*/
-    lv_pool_t * pool_p = lv_ll_ins_tail(&state.pool_ll);
-    LV_ASSERT_MALLOC(pool_p);
-    *pool_p = lv_tlsf_get_pool(state.tlsf);
+#if LV_MEM_LARGE_SIZE
+    static LV_ATTRIBUTE_MEM_LARGE MEM_UNIT large_mem_int[LV_MEM_LARGE_SIZE / sizeof(MEM_UNIT)];
+    add_pool(LV_MEM_REGION_LARGE, (void *)large_mem_int, LV_MEM_LARGE_SIZE);
+#endif
 
 #if LV_MEM_ADD_JUNK
     LV_LOG_WARN("LV_MEM_ADD_JUNK is enabled which makes LVGL much slower");
@@ -101,7 +107,13 @@ void lv_mem_init(void)
 void lv_mem_deinit(void)
 {
     lv_ll_clear(&state.pool_ll);
-    lv_tlsf_destroy(state.tlsf);
+    uint32_t i;
+    for(i = 0; i < LV_MEM_REGION_NUM; i++) {
+        if(state.tlsf[i]) lv_tlsf_destroy(state.tlsf[i]);
+        state.tlsf[i] = NULL;
+    }
+    state.cur_used = 0;
+    state.max_used = 0;
 #if LV_USE_OS
     lv_mutex_delete(&state.mutex);
 #endif
@@ -109,27 +121,26 @@ void lv_mem_deinit(void)
 
 lv_mem_pool_t lv_mem_add_pool(void * mem, size_t bytes)
 {
-    lv_mem_pool_t new_pool = lv_tlsf_add_pool(state.tlsf, mem, bytes);
-    if(!new_pool) {
-        LV_LOG_WARN("failed to add memory pool, address: %p, size: %zu", mem, bytes);
-        return NULL;
-    }
+    return lv_mem_add_region_pool(LV_MEM_REGION_FAST, mem, bytes);
+}
 
-    lv_pool_t * pool_p = lv_ll_ins_tail(&state.pool_ll);
-    LV_ASSERT_MALLOC(pool_p);
-    *pool_p = new_pool;
+lv_mem_pool_t lv_mem_add_region_pool(lv_mem_region_t region, void * mem, size_t bytes)
+{
+    LV_ASSERT(region < LV_MEM_REGION_NUM);
 
-    return new_pool;
+    lv_tlsf_pool_dsc_t * pool_dsc = add_pool(region, mem, bytes);
+    return pool_dsc ? pool_dsc->pool : NULL;
 }
 
 void lv_mem_remove_pool(lv_mem_pool_t pool)
 {
-    lv_pool_t * pool_p;
-    LV_LL_READ(&state.pool_ll, pool_p) {
-        if(*pool_p == pool) {
-            lv_ll_remove(&state.pool_ll, pool_p);
-            lv_free(pool_p);
-            lv_tlsf_remove_pool(state.tlsf, pool);
+    lv_tlsf_pool_dsc_t * pool_dsc;
+    LV_LL_READ(&state.pool_ll, pool_dsc) {
+        if(pool_dsc->pool == pool) {
+            lv_tlsf_t tlsf = state.tlsf[pool_dsc->region];
+            lv_ll_remove(&state.pool_ll, pool_dsc);
+            lv_free(pool_dsc);
+            lv_tlsf_remove_pool(tlsf, pool);
             return;
         }
     }
@@ -137,16 +148,17 @@ void lv_mem_remove_pool(lv_mem_pool_t pool)
 }
 
 void * lv_malloc_core(size_t size)
+{
+    return lv_malloc_region_core(size, LV_MEM_REGION_FAST);
+}
+
+void * lv_malloc_region_core(size_t size, lv_mem_region_t region)
 {
 #if LV_USE_OS
     lv_mutex_lock(&state.mutex);
 #endif
-    void * p = lv_tlsf_malloc(state.tlsf, size);
-
-    if(p) {
-        state.cur_used += lv_tlsf_block_size(p);
-        state.max_used = LV_MAX(state.cur_used, state.max_used);
-    }
+    void * p = region_malloc(size, region, true);
+    if(p) used_add(p);
 
 #if LV_USE_OS
     lv_mutex_unlock(&state.mutex);
@@ -160,13 +172,23 @@ void * lv_realloc_core(void * p, size_t new_size)
     lv_mutex_lock(&state.mutex);
 #endif
 
+    lv_tlsf_pool_dsc_t * pool_dsc = find_pool(p);
+    lv_mem_region_t region = pool_dsc ? pool_dsc->region : LV_MEM_REGION_FAST;
     size_t old_size = lv_tlsf_block_size(p);
-    void * p_new = lv_tlsf_realloc(state.tlsf, p, new_size);
+    void * p_new = lv_tlsf_realloc(state.tlsf[region], p, new_size);
+
+    /*If the region is full move the data to an other one*/
+    if(p_new == NULL) {
+        p_new = region_malloc(new_size, region, true);
+        if(p_new) {
+            lv_memcpy(p_new, p, LV_MIN(old_size, new_size));
+            lv_tlsf_free(state.tlsf[region], p);
+        }
+    }
 
     if(p_new) {
-        state.cur_used -= old_size;
-        state.cur_used += lv_tlsf_block_size(p_new);
-        state.max_used = LV_MAX(state.cur_used, state.max_used);
+        used_remove(pool_dsc, old_size);
+        used_add(p_new);
     }
 #if LV_USE_OS
     lv_mutex_unlock(&state.mutex);
@@ -184,10 +206,10 @@ void lv_free_core(void * p)
 #if LV_MEM_ADD_JUNK
     lv_memset(p, 0xbb, lv_tlsf_block_size(data));
 #endif
+    lv_tlsf_pool_dsc_t * pool_dsc = find_pool(p);
     size_t size = lv_tlsf_block_size(p);
-    lv_tlsf_free(state.tlsf, p);
-    if(state.cur_used > size) state.cur_used -= size;
-    else state.cur_used = 0;
+    lv_tlsf_free(state.tlsf[pool_dsc ? pool_dsc->region : LV_MEM_REGION_FAST], p);
+    used_remove(pool_dsc, size);
 
 #if LV_USE_OS
     lv_mutex_unlock(&state.mutex);
@@ -200,41 +222,54 @@ void lv_mem_monitor_core(lv_mem_monitor_t * mon_p)
     lv_memzero(mon_p, sizeof(lv_mem_monitor_t));
     LV_TRACE_MEM("begin");
 
-    lv_pool_t * pool_p;
-    LV_LL_READ(&state.pool_ll, pool_p) {
-        lv_tlsf_walk_pool(*pool_p, lv_mem_walker, mon_p);
-    }
-
-    mon_p->used_pct = 100 - (uint64_t)100U * mon_p->free_size / mon_p->total_size;
-    if(mon_p->free_size > 0) {
-        mon_p->frag_pct = (uint64_t)mon_p->free_biggest_size * 100U / mon_p->free_size;
-        mon_p->frag_pct = 100 - mon_p->frag_pct;
-    }
-    else {
-        mon_p->frag_pct = 0; /*no fragmentation if all the RAM is used*/
+    lv_tlsf_pool_dsc_t * pool_dsc;
+    LV_LL_READ(&state.pool_ll, pool_dsc) {
+        lv_tlsf_walk_pool(pool_dsc->pool, lv_mem_walker, mon_p);
     }
 
+    monitor_finish(mon_p);
     mon_p->max_used = state.max_used;
 
     LV_TRACE_MEM("finished");
 }
 
+lv_result_t lv_mem_monitor_pool(uint32_t idx, lv_mem_monitor_t * mon_p)
+{
+    lv_memzero(mon_p, sizeof(lv_mem_monitor_t));
+
+    lv_tlsf_pool_dsc_t * pool_dsc;
+    LV_LL_READ(&state.pool_ll, pool_dsc) {
+        if(idx == 0) {
+            lv_tlsf_walk_pool(pool_dsc->pool, lv_mem_walker, mon_p);
+            monitor_finish(mon_p);
+            mon_p->max_used = pool_dsc->max_used;
+            return LV_RESULT_OK;
+        }
+        idx--;
+    }
+
+    return LV_RESULT_INVALID;
+}
+
 lv_result_t lv_mem_test_core(void)
 {
 #if LV_USE_OS
     lv_mutex_lock(&state.mutex);
 #endif
-    if(lv_tlsf_check(state.tlsf)) {
-        LV_LOG_WARN("failed");
+    uint32_t i;
+    for(i = 0; i < LV_MEM_REGION_NUM; i++) {
+        if(state.tlsf[i] && lv_tlsf_check(state.tlsf[i])) {
+            LV_LOG_WARN("failed");
 #if LV_USE_OS
-        lv_mutex_unlock(&state.mutex);
+            lv_mutex_unlock(&state.mutex);
 #endif
-        return LV_RESULT_INVALID;
+            return LV_RESULT_INVALID;
+        }
     }
 
-    lv_pool_t * pool_p;
-    LV_LL_READ(&state.pool_ll, pool_p) {
-        if(lv_tlsf_check_pool(*pool_p)) {
+    lv_tlsf_pool_dsc_t * pool_dsc;
+    LV_LL_READ(&state.pool_ll, pool_dsc) {
+        if(lv_tlsf_check_pool(pool_dsc->pool)) {
             LV_LOG_WARN("pool failed");
 #if LV_USE_OS
             lv_mutex_unlock(&state.mutex);
@@ -254,6 +289,109 @@ lv_result_t lv_mem_test_core(void)
  *   STATIC FUNCTIONS
  **********************/
 
+static lv_tlsf_pool_dsc_t * add_pool(lv_mem_region_t region, void * mem, size_t bytes)
+{
+    /*The first pool of a region creates its allocator, whose control structure is stored before the pool*/
+    lv_pool_t new_pool;
+    bool created = false;
+    if(state.tlsf[region] == NULL) {
+        state.tlsf[region] = lv_tlsf_create_with_pool(mem, bytes);
+        new_pool = state.tlsf[region] ? lv_tlsf_get_pool(state.tlsf[region]) : NULL;
+        created = true;
+    }
+    else {
+        new_pool = lv_tlsf_add_pool(state.tlsf[region], mem, bytes);
+    }
+
+    if(!new_pool) {
+        LV_LOG_WARN("failed to add memory pool, address: %p, size: %zu", mem, bytes);
+        return NULL;
+    }
+
+    lv_tlsf_pool_dsc_t * pool_dsc = lv_ll_ins_tail(&state.pool_ll);
+    LV_ASSERT_MALLOC(pool_dsc);
+    if(pool_dsc == NULL) {
+        if(created) {
+            lv_tlsf_destroy(state.tlsf[region]);
+            state.tlsf[region] = NULL;
+        }
+        else {
+            lv_tlsf_remove_pool(state.tlsf[region], new_pool);
+        }
+        return NULL;
+    }
+
+    pool_dsc->pool = new_pool;
+    pool_dsc->end = (uint8_t *)mem + bytes;
+    pool_dsc->region = region;
+    pool_dsc->cur_used = 0;
+    pool_dsc->max_used = 0;
+
+    return pool_dsc;
+}
+
+static lv_tlsf_pool_dsc_t * find_pool(const void * p)
+{
+    const uint8_t * p_u8 = p;
+    lv_tlsf_pool_dsc_t * pool_dsc;
+    LV_LL_READ(&state.pool_ll, pool_dsc) {
+        if(p_u8 >= (uint8_t *)pool_dsc->pool && p_u8 < pool_dsc->end) return pool_dsc;
+    }
+
+    return NULL;
+}
+
+static void * region_malloc(size_t size, lv_mem_region_t region, bool other_regions)
+{
+    void * p = NULL;
+    if(state.tlsf[region]) p = lv_tlsf_malloc(state.tlsf[region], size);
+    if(p || !other_regions) return p;
+
+    /*Grow into the other regions if the preferred one is full*/
+    uint32_t i;
+    for(i = 0; i < LV_MEM_REGION_NUM && p == NULL; i++) {
+        if(i != region) p = region_malloc(size, i, false);
+    }
+
+    return p;
+}
+
+static void used_add(void * p)
+{
+    size_t size = lv_tlsf_block_size(p);
+    state.cur_used += size;
+    state.max_used = LV_MAX(state.cur_used, state.max_used);
+
+    lv_tlsf_pool_dsc_t * pool_dsc = find_pool(p);
+    if(pool_dsc) {
+        pool_dsc->cur_used += size;
+        pool_dsc->max_used = LV_MAX(pool_dsc->cur_used, pool_dsc->max_used);
+    }
+}
+
+static void used_remove(lv_tlsf_pool_dsc_t * pool_dsc, size_t size)
+{
+    if(state.cur_used > size) state.cur_used -= size;
+    else state.cur_used = 0;
+
+    if(pool_dsc) {
+        if(pool_dsc->cur_used > size) pool_dsc->cur_used -= size;
+        else pool_dsc->cur_used = 0;
+    }
+}
+
+static void monitor_finish(lv_mem_monitor_t * mon_p)
+{
+    mon_p->used_pct = 100 - (uint64_t)100U * mon_p->free_size / mon_p->total_size;
+    if(mon_p->free_size > 0) {
+        mon_p->frag_pct = (uint64_t)mon_p->free_biggest_size * 100U / mon_p->free_size;
+        mon_p->frag_pct = 100 - mon_p->frag_pct;
+    }
+    else {
+        mon_p->frag_pct = 0; /*no fragmentation if all the RAM is used*/
+    }
+}
+
 static void lv_mem_walker(void * ptr, size_t size, int used, void * user)
 {
     LV_UNUSED(ptr);
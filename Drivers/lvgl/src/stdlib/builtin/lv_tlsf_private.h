@@ -17,6 +17,7 @@ extern "C" {
  *********************/
 
 #include "lv_tlsf.h"
+#include "../lv_mem.h"
 #include "../../osal/lv_os.h"
 
 /*********************
@@ -27,14 +28,23 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+/** A memory pool and its usage*/
+typedef struct {
+    lv_pool_t pool;
+    uint8_t * end;              /**< The first byte after the pool*/
+    lv_mem_region_t region;
+    size_t cur_used;
+    size_t max_used;
+} lv_tlsf_pool_dsc_t;
+
 typedef struct {
 #if LV_USE_OS
     lv_mutex_t mutex;
 #endif
-    lv_tlsf_t tlsf;
+    lv_tlsf_t tlsf[LV_MEM_REGION_NUM];  /**< An allocator for each region, NULL if it has no pools yet*/
     size_t cur_used;
     size_t max_used;
-    lv_ll_t  pool_ll;
+    lv_ll_t  pool_ll;                   /**< lv_tlsf_pool_dsc_t of all regions in the order of adding them*/
 } lv_tlsf_state_t;
 
 /**********************
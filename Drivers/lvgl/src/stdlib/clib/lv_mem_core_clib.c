@@ -59,6 +59,15 @@ void lv_mem_remove_pool(lv_mem_pool_t pool)
     return;
 }
 
+lv_mem_pool_t lv_mem_add_region_pool(lv_mem_region_t region, void * mem, size_t bytes)
+{
+    /*Not supported*/
+    LV_UNUSED(region);
+    LV_UNUSED(mem);
+    LV_UNUSED(bytes);
+    return NULL;
+}
+
 void * lv_malloc_core(size_t size)
 {
     return malloc(size);
@@ -81,6 +90,14 @@ void lv_mem_monitor_core(lv_mem_monitor_t * mon_p)
     return;
 }
 
+lv_result_t lv_mem_monitor_pool(uint32_t idx, lv_mem_monitor_t * mon_p)
+{
+    /*Not supported*/
+    LV_UNUSED(idx);
+    LV_UNUSED(mon_p);
+    return LV_RESULT_INVALID;
+}
+
 lv_result_t lv_mem_test_core(void)
 {
     /*Not supported*/
@@ -37,6 +37,7 @@
  *  GLOBAL PROTOTYPES
  **********************/
 void * lv_malloc_core(size_t size);
+void * lv_malloc_region_core(size_t size, lv_mem_region_t region);
 void * lv_realloc_core(void * p, size_t new_size);
 void lv_free_core(void * p);
 void lv_mem_monitor_core(lv_mem_monitor_t * mon_p);
@@ -89,6 +90,34 @@ void * lv_malloc(size_t size)
     return alloc;
 }
 
+void * lv_malloc_region(size_t size, lv_mem_region_t region)
+{
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN
+    LV_TRACE_MEM("allocating %lu bytes in region %d", (unsigned long)size, region);
+    if(size == 0) {
+        LV_TRACE_MEM("using zero_mem");
+        return &zero_mem;
+    }
+
+    void * alloc = lv_malloc_region_core(size, region);
+    if(alloc == NULL) {
+        LV_LOG_INFO("couldn't allocate memory (%lu bytes)", (unsigned long)size);
+        return NULL;
+    }
+
+#if LV_MEM_ADD_JUNK
+    lv_memset(alloc, 0xaa, size);
+#endif
+
+    LV_TRACE_MEM("allocated at %p", alloc);
+    return alloc;
+#else
+    /*Only the built-in allocator has regions*/
+    LV_UNUSED(region);
+    return lv_malloc(size);
+#endif
+}
+
 void * lv_malloc_zeroed(size_t size)
 {
     LV_TRACE_MEM("allocating %lu bytes", (unsigned long)size);
@@ -29,6 +29,16 @@ extern "C" {
 
 typedef void * lv_mem_pool_t;
 
+/**
+ * Memory regions of the built-in allocator. Each region has its own pools,
+ * e.g. in memories with different speed or DMA accessibility.
+ */
+typedef enum {
+    LV_MEM_REGION_FAST,     /**< Small, frequently used data: widgets, styles, etc. The pool of `LV_MEM_SIZE`*/
+    LV_MEM_REGION_LARGE,    /**< Large buffers: draw buffers, decoded images and layers. The pool of `LV_MEM_LARGE_SIZE`*/
+    LV_MEM_REGION_NUM,
+} lv_mem_region_t;
+
 /**
  * Heap information structure.
  */
@@ -61,6 +71,15 @@ lv_mem_pool_t lv_mem_add_pool(void * mem, size_t bytes);
 
 void lv_mem_remove_pool(lv_mem_pool_t pool);
 
+/**
+ * Add a memory pool to a region of the built-in allocator
+ * @param region    the region to which the pool should belong
+ * @param mem       start address of the memory
+ * @param bytes     size of the memory
+ * @return          the new pool or NULL on failure
+ */
+lv_mem_pool_t lv_mem_add_region_pool(lv_mem_region_t region, void * mem, size_t bytes);
+
 /**
  * Allocate memory dynamically
  * @param size requested size in bytes
@@ -68,6 +87,16 @@ void lv_mem_remove_pool(lv_mem_pool_t pool);
  */
 void * lv_malloc(size_t size);
 
+/**
+ * Allocate memory dynamically in a given region.
+ * If the region is full, or has no pools, the other regions are used.
+ * The allocated memory can be freed and reallocated by `lv_free()` and `lv_realloc()`.
+ * @param size      requested size in bytes
+ * @param region    the preferred region
+ * @return pointer to allocated uninitialized memory, or NULL on failure
+ */
+void * lv_malloc_region(size_t size, lv_mem_region_t region);
+
 /**
  * Allocate a block of zeroed memory dynamically
  * @param num requested number of element to be allocated.
@@ -121,6 +150,13 @@ void * lv_reallocf(void * data_p, size_t new_size);
  */
 void * lv_malloc_core(size_t size);
 
+/**
+ * Used internally to execute a `malloc` operation in a region of the built-in allocator
+ * @param size      size in bytes to `malloc`
+ * @param region    the preferred region
+ */
+void * lv_malloc_region_core(size_t size, lv_mem_region_t region);
+
 /**
  * Used internally to execute a plain `free` operation
  * @param p      memory address to free
@@ -155,6 +191,16 @@ lv_result_t lv_mem_test(void);
  */
 void lv_mem_monitor(lv_mem_monitor_t * mon_p);
 
+/**
+ * Give information about a single memory pool of the built-in allocator
+ * @param idx       index of the pool in the order of adding them.
+ *                  0: the pool of `LV_MEM_SIZE`, 1: the pool of `LV_MEM_LARGE_SIZE` if enabled.
+ * @param mon_p     pointer to a lv_mem_monitor_t variable,
+ *                  the result of the analysis will be stored here
+ * @return          LV_RESULT_INVALID if there is no pool with the given index
+ */
+lv_result_t lv_mem_monitor_pool(uint32_t idx, lv_mem_monitor_t * mon_p);
+
 /**********************
  *      MACROS
  **********************/
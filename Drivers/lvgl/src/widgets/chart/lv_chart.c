@@ -15,6 +15,7 @@
 #if LV_USE_CHART != 0
 
 #include "../../misc/lv_assert.h"
+#include "../../display/lv_display.h"
 
 /*********************
  *      DEFINES
@@ -37,14 +38,24 @@ static void lv_chart_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
 static void lv_chart_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void lv_chart_event(const lv_obj_class_t * class_p, lv_event_t * e);
 
-static void draw_div_lines(lv_obj_t * obj, lv_layer_t * layer);
+static void draw_div_lines(lv_obj_t * obj, lv_layer_t * layer, bool hor, bool ver);
 static void draw_series_line(lv_obj_t * obj, lv_layer_t * layer);
+#if LV_USE_DRAW_SW && LV_DRAW_SW_POLYLINE
+static void draw_series_polyline(lv_obj_t * obj, lv_layer_t * layer, lv_chart_series_t * ser,
+                                 lv_draw_line_dsc_t * line_dsc, lv_draw_rect_dsc_t * point_dsc);
+#endif
 static void draw_series_bar(lv_obj_t * obj, lv_layer_t * layer);
 static void draw_series_scatter(lv_obj_t * obj, lv_layer_t * layer);
 static void draw_cursors(lv_obj_t * obj, lv_layer_t * layer);
 static uint32_t get_index_from_x(lv_obj_t * obj, int32_t x);
 static void invalidate_point(lv_obj_t * obj, uint32_t i);
 static void new_points_alloc(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t cnt, int32_t ** a);
+static lv_result_t stream_draw(lv_obj_t * obj, lv_layer_t * layer);
+static void stream_update(lv_obj_t * obj, const lv_area_t * content_area);
+static void stream_render(lv_obj_t * obj, const lv_area_t * content_area, int32_t x1, int32_t x2);
+static void stream_invalidate_point(lv_obj_t * obj, uint32_t i);
+static uint32_t stream_hash_add(uint32_t hash, uint32_t v);
+static uint32_t stream_get_style_hash(lv_obj_t * obj);
 
 /**********************
  *  STATIC VARIABLES
@@ -207,7 +218,17 @@ void lv_chart_set_update_mode(lv_obj_t * obj, lv_chart_update_mode_t update_mode
     if(chart->update_mode == update_mode) return;
 
     chart->update_mode = update_mode;
-    lv_obj_invalidate(obj);
+    lv_chart_refresh(obj);
+}
+
+void lv_chart_set_stream_buffer(lv_obj_t * obj, lv_draw_buf_t * draw_buf)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    if(chart->stream_buf) lv_image_cache_drop(chart->stream_buf);
+    chart->stream_buf = draw_buf;
+    lv_chart_refresh(obj);
 }
 
 void lv_chart_set_div_line_count(lv_obj_t * obj, uint32_t hdiv, uint32_t vdiv)
@@ -220,7 +241,7 @@ void lv_chart_set_div_line_count(lv_obj_t * obj, uint32_t hdiv, uint32_t vdiv)
     chart->hdiv_cnt = hdiv;
     chart->vdiv_cnt = vdiv;
 
-    lv_obj_invalidate(obj);
+    lv_chart_refresh(obj);
 }
 
 void lv_chart_set_hor_div_line_count(lv_obj_t * obj, uint32_t cnt)
@@ -230,7 +251,7 @@ void lv_chart_set_hor_div_line_count(lv_obj_t * obj, uint32_t cnt)
     lv_chart_t * chart  = (lv_chart_t *)obj;
     if(chart->hdiv_cnt == cnt) return;
     chart->hdiv_cnt = cnt;
-    lv_obj_invalidate(obj);
+    lv_chart_refresh(obj);
 }
 
 void lv_chart_set_ver_div_line_count(lv_obj_t * obj, uint32_t cnt)
@@ -240,7 +261,7 @@ void lv_chart_set_ver_div_line_count(lv_obj_t * obj, uint32_t cnt)
     lv_chart_t * chart  = (lv_chart_t *)obj;
     if(chart->vdiv_cnt == cnt) return;
     chart->vdiv_cnt = cnt;
-    lv_obj_invalidate(obj);
+    lv_chart_refresh(obj);
 }
 
 lv_chart_type_t lv_chart_get_type(const lv_obj_t * obj)
@@ -259,6 +280,14 @@ uint32_t lv_chart_get_point_count(const lv_obj_t * obj)
     return chart->point_cnt;
 }
 
+lv_draw_buf_t * lv_chart_get_stream_buffer(const lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    return chart->stream_buf;
+}
+
 uint32_t lv_chart_get_x_start_point(const lv_obj_t * obj, lv_chart_series_t * ser)
 {
     LV_ASSERT_NULL(ser);
@@ -351,6 +380,8 @@ void lv_chart_refresh(lv_obj_t * obj)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    chart->stream_valid = 0;
     lv_obj_invalidate(obj);
 }
 
@@ -417,6 +448,8 @@ lv_chart_series_t * lv_chart_add_series(lv_obj_t * obj, lv_color_t color, lv_cha
         p_tmp++;
     }
 
+    chart->stream_valid = 0;
+
     return ser;
 }
 
@@ -432,6 +465,8 @@ void lv_chart_remove_series(lv_obj_t * obj, lv_chart_series_t * series)
     lv_ll_remove(&chart->series_ll, series);
     lv_free(series);
 
+    chart->stream_valid = 0;
+
     return;
 }
 
@@ -470,6 +505,7 @@ void lv_chart_set_x_start_point(lv_obj_t * obj, lv_chart_series_t * ser, uint32_
     lv_chart_t * chart  = (lv_chart_t *)obj;
     if(id >= chart->point_cnt) return;
     ser->start_point = id;
+    chart->stream_valid = 0;
 }
 
 lv_chart_series_t * lv_chart_get_series_next(const lv_obj_t * obj, const lv_chart_series_t * ser)
@@ -579,6 +615,15 @@ void lv_chart_set_next_value(lv_obj_t * obj, lv_chart_series_t * ser, int32_t va
 
     lv_chart_t * chart  = (lv_chart_t *)obj;
     ser->y_points[ser->start_point] = value;
+
+    /*In the stream buffer only the new columns need to be drawn after shifting it*/
+    if(chart->stream_buf && chart->update_mode == LV_CHART_UPDATE_MODE_SHIFT) {
+        ser->start_point = (ser->start_point + 1) % chart->point_cnt;
+        if(ser == lv_chart_get_series_next(obj, NULL)) chart->stream_shift_cnt++;
+        lv_obj_invalidate(obj);
+        return;
+    }
+
     invalidate_point(obj, ser->start_point);
     ser->start_point = (ser->start_point + 1) % chart->point_cnt;
     invalidate_point(obj, ser->start_point);
@@ -657,7 +702,7 @@ void lv_chart_set_series_ext_y_array(lv_obj_t * obj, lv_chart_series_t * ser, in
     if(!ser->y_ext_buf_assigned && ser->y_points) lv_free(ser->y_points);
     ser->y_ext_buf_assigned = true;
     ser->y_points = array;
-    lv_obj_invalidate(obj);
+    lv_chart_refresh(obj);
 }
 
 void lv_chart_set_series_ext_x_array(lv_obj_t * obj, lv_chart_series_t * ser, int32_t array[])
@@ -668,7 +713,7 @@ void lv_chart_set_series_ext_x_array(lv_obj_t * obj, lv_chart_series_t * ser, in
     if(!ser->x_ext_buf_assigned && ser->x_points) lv_free(ser->x_points);
     ser->x_ext_buf_assigned = true;
     ser->x_points = array;
-    lv_obj_invalidate(obj);
+    lv_chart_refresh(obj);
 }
 
 int32_t * lv_chart_get_series_y_array(const lv_obj_t * obj, lv_chart_series_t * ser)
@@ -771,6 +816,9 @@ static void lv_chart_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     }
     lv_ll_clear(&chart->cursor_ll);
 
+    /*The buffer is owned by the application, but the image cache may still refer to it*/
+    if(chart->stream_buf) lv_image_cache_drop(chart->stream_buf);
+
     LV_TRACE_OBJ_CREATE("finished");
 }
 
@@ -806,6 +854,9 @@ static void lv_chart_event(const lv_obj_class_t * class_p, lv_event_t * e)
         invalidate_point(obj, chart->pressed_point_id);
         chart->pressed_point_id = LV_CHART_POINT_NONE;
     }
+    else if(code == LV_EVENT_STYLE_CHANGED || code == LV_EVENT_SIZE_CHANGED) {
+        chart->stream_valid = 0;
+    }
     else if(code == LV_EVENT_DRAW_MAIN) {
         lv_layer_t * layer = lv_event_get_layer(e);
 
@@ -819,12 +870,14 @@ static void lv_chart_event(const lv_obj_class_t * class_p, lv_event_t * e)
             const lv_area_t clip_area_ori = layer->_clip_area;
             layer->_clip_area = clip_area;
 
-            draw_div_lines(obj, layer);
+            if(stream_draw(obj, layer) != LV_RESULT_OK) {
+                draw_div_lines(obj, layer, true, true);
 
-            if(lv_ll_is_empty(&chart->series_ll) == false) {
-                if(chart->type == LV_CHART_TYPE_LINE) draw_series_line(obj, layer);
-                else if(chart->type == LV_CHART_TYPE_BAR) draw_series_bar(obj, layer);
-                else if(chart->type == LV_CHART_TYPE_SCATTER) draw_series_scatter(obj, layer);
+                if(lv_ll_is_empty(&chart->series_ll) == false) {
+                    if(chart->type == LV_CHART_TYPE_LINE) draw_series_line(obj, layer);
+                    else if(chart->type == LV_CHART_TYPE_BAR) draw_series_bar(obj, layer);
+                    else if(chart->type == LV_CHART_TYPE_SCATTER) draw_series_scatter(obj, layer);
+                }
             }
 
             draw_cursors(obj, layer);
@@ -834,7 +887,7 @@ static void lv_chart_event(const lv_obj_class_t * class_p, lv_event_t * e)
     }
 }
 
-static void draw_div_lines(lv_obj_t * obj, lv_layer_t * layer)
+static void draw_div_lines(lv_obj_t * obj, lv_layer_t * layer, bool hor, bool ver)
 {
     lv_chart_t * chart  = (lv_chart_t *)obj;
 
@@ -858,7 +911,7 @@ static void draw_div_lines(lv_obj_t * obj, lv_layer_t * layer)
 
     int32_t scroll_left = lv_obj_get_scroll_left(obj);
     int32_t scroll_top = lv_obj_get_scroll_top(obj);
-    if(chart->hdiv_cnt != 0) {
+    if(hor && chart->hdiv_cnt != 0) {
         int32_t y_ofs = obj->coords.y1 + pad_top - scroll_top;
         line_dsc.p1.x = obj->coords.x1;
         line_dsc.p2.x = obj->coords.x2;
@@ -880,7 +933,7 @@ static void draw_div_lines(lv_obj_t * obj, lv_layer_t * layer)
         }
     }
 
-    if(chart->vdiv_cnt != 0) {
+    if(ver && chart->vdiv_cnt != 0) {
         int32_t x_ofs = obj->coords.x1 + pad_left - scroll_left;
         line_dsc.p1.y = obj->coords.y1;
         line_dsc.p2.y = obj->coords.y2;
@@ -938,6 +991,11 @@ static void draw_series_line(lv_obj_t * obj, lv_layer_t * layer)
         return;
     }
 
+#if LV_USE_DRAW_SW && LV_DRAW_SW_POLYLINE
+    /*Draw the lines of a series in one draw task if the tasks of the segments are not needed in the draw task events*/
+    bool polyline = !crowded_mode && !lv_obj_has_flag(obj, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS);
+#endif
+
     line_dsc.base.id1 = ser_cnt - 1;
     point_dsc_default.base.id1 = line_dsc.base.id1;
     /*Go through all data lines*/
@@ -954,6 +1012,17 @@ static void draw_series_line(lv_obj_t * obj, lv_layer_t * layer)
         line_dsc.base.id2 = 0;
         point_dsc_default.base.id2 = 0;
 
+#if LV_USE_DRAW_SW && LV_DRAW_SW_POLYLINE
+        if(polyline) {
+            draw_series_polyline(obj, layer, ser, &line_dsc, &point_dsc_default);
+            if(line_dsc.base.id1 > 0) {
+                line_dsc.base.id1--;
+                point_dsc_default.base.id1--;
+            }
+            continue;
+        }
+#endif
+
         int32_t start_point = chart->update_mode == LV_CHART_UPDATE_MODE_SHIFT ? ser->start_point : 0;
 
         line_dsc.p1.x = x_ofs;
@@ -1050,6 +1119,103 @@ static void draw_series_line(lv_obj_t * obj, lv_layer_t * layer)
     }
 }
 
+#if LV_USE_DRAW_SW && LV_DRAW_SW_POLYLINE
+/**
+ * Draw a series of a line chart with one polyline draw task for every run of consecutive points.
+ * Only the points whose lines can be in the clip area are used.
+ * @param obj           pointer to a chart
+ * @param layer         the layer to draw to
+ * @param ser           the series to draw
+ * @param line_dsc      the line draw descriptor of the series
+ * @param point_dsc     the draw descriptor of the series' points
+ */
+static void draw_series_polyline(lv_obj_t * obj, lv_layer_t * layer, lv_chart_series_t * ser,
+                                 lv_draw_line_dsc_t * line_dsc, lv_draw_rect_dsc_t * point_dsc)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    int32_t border_width = lv_obj_get_style_border_width(obj, LV_PART_MAIN);
+    int32_t pad_left = lv_obj_get_style_pad_left(obj, LV_PART_MAIN) + border_width;
+    int32_t pad_top = lv_obj_get_style_pad_top(obj, LV_PART_MAIN) + border_width;
+    int32_t w     = lv_obj_get_content_width(obj);
+    int32_t h     = lv_obj_get_content_height(obj);
+    int32_t x_ofs = obj->coords.x1 + pad_left - lv_obj_get_scroll_left(obj);
+    int32_t y_ofs = obj->coords.y1 + pad_top - lv_obj_get_scroll_top(obj);
+    int32_t point_w = lv_obj_get_style_width(obj, LV_PART_INDICATOR) / 2;
+    int32_t point_h = lv_obj_get_style_height(obj, LV_PART_INDICATOR) / 2;
+    int32_t y_min = chart->ymin[ser->y_axis_sec];
+    int32_t y_range = chart->ymax[ser->y_axis_sec] - y_min;
+    int32_t start_point = chart->update_mode == LV_CHART_UPDATE_MODE_SHIFT ? ser->start_point : 0;
+    uint32_t point_cnt = chart->point_cnt;
+    int32_t clip_x1 = layer->_clip_area.x1 - point_w - 1;
+    int32_t clip_x2 = layer->_clip_area.x2 + point_w + 1;
+
+    /*Find the first point whose next point is not left to the clip area
+     *and the first point right to the clip area*/
+    uint32_t i_start = 0;
+    while(i_start + 1 < point_cnt && (int32_t)((w * (i_start + 1)) / (point_cnt - 1)) + x_ofs < clip_x1) i_start++;
+    uint32_t i_end = i_start;
+    while(i_end + 1 < point_cnt && (int32_t)((w * i_end) / (point_cnt - 1)) + x_ofs <= clip_x2) i_end++;
+
+    /*Draw a polyline for every run of points between the LV_CHART_POINT_NONE points*/
+    uint32_t i = i_start;
+    while(i <= i_end) {
+        if(ser->y_points[(start_point + i) % point_cnt] == LV_CHART_POINT_NONE) {
+            i++;
+            continue;
+        }
+
+        uint32_t run_start = i;
+        while(i < i_end && ser->y_points[(start_point + i + 1) % point_cnt] != LV_CHART_POINT_NONE) i++;
+        uint32_t run_cnt = i - run_start + 1;
+        i++;
+        if(run_cnt < 2) continue;
+
+        /*The draw task takes over the points. Skip the run if there is no memory for them.*/
+        lv_point_precise_t * points = lv_malloc(sizeof(lv_point_precise_t) * run_cnt);
+        LV_ASSERT_MALLOC(points);
+        if(points == NULL) continue;
+
+        uint32_t k;
+        for(k = 0; k < run_cnt; k++) {
+            uint32_t p = run_start + k;
+            int32_t p_act = (start_point + p) % point_cnt;
+            points[k].x = (lv_value_precise_t)((w * p) / (point_cnt - 1)) + x_ofs;
+            points[k].y = h - (ser->y_points[p_act] - y_min) * h / y_range + y_ofs;
+        }
+
+        line_dsc->points = points;
+        line_dsc->point_cnt = run_cnt;
+        line_dsc->points_owned = 1;
+        line_dsc->base.id2 = run_start + 1;
+        lv_draw_line(layer, line_dsc);
+    }
+
+    line_dsc->points = NULL;
+    line_dsc->point_cnt = 0;
+    line_dsc->points_owned = 0;
+
+    /*Draw the points. As in `draw_series_line` the last point is drawn even if the points have no size
+     *but only if there was no point right to the clip area*/
+    for(i = i_start; i <= i_end; i++) {
+        bool last = i + 1 == point_cnt;
+        if(!last && (point_w == 0 || point_h == 0 || i == i_end)) continue;
+
+        int32_t p_act = (start_point + i) % point_cnt;
+        if(ser->y_points[p_act] == LV_CHART_POINT_NONE) continue;
+
+        int32_t x = (int32_t)((w * i) / (point_cnt - 1)) + x_ofs;
+        int32_t y = h - (ser->y_points[p_act] - y_min) * h / y_range + y_ofs;
+        lv_area_t point_area;
+        point_area.x1 = x - point_w;
+        point_area.x2 = x + point_w;
+        point_area.y1 = y - point_h;
+        point_area.y2 = y + point_h;
+        point_dsc->base.id2 = i;
+        lv_draw_rect(layer, point_dsc, &point_area);
+    }
+}
+#endif
+
 static void draw_series_scatter(lv_obj_t * obj, lv_layer_t * layer)
 {
     lv_chart_t * chart  = (lv_chart_t *)obj;
@@ -1378,6 +1544,8 @@ static void invalidate_point(lv_obj_t * obj, uint32_t i)
     lv_chart_t * chart  = (lv_chart_t *)obj;
     if(i >= chart->point_cnt) return;
 
+    if(chart->stream_buf) stream_invalidate_point(obj, i);
+
     int32_t w  = lv_obj_get_content_width(obj);
     int32_t scroll_left = lv_obj_get_scroll_left(obj);
 
@@ -1481,4 +1649,285 @@ static void new_points_alloc(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t c
     }
 }
 
+/**
+ * Draw the plot area from the stream buffer
+ * @param obj       pointer to a chart
+ * @param layer     the layer to draw to
+ * @return          LV_RESULT_OK: drawn; LV_RESULT_INVALID: the buffer can't be used, draw the chart as usual
+ */
+static lv_result_t stream_draw(lv_obj_t * obj, lv_layer_t * layer)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    lv_draw_buf_t * buf = chart->stream_buf;
+    if(buf == NULL || chart->type != LV_CHART_TYPE_LINE) return LV_RESULT_INVALID;
+    if(lv_obj_get_scroll_left(obj) != 0 || lv_obj_get_scroll_top(obj) != 0) return LV_RESULT_INVALID;
+
+    lv_area_t content_area;
+    lv_obj_get_content_coords(obj, &content_area);
+    int32_t w = lv_area_get_width(&content_area);
+    int32_t h = lv_area_get_height(&content_area);
+    if(w <= 0 || h <= 0) return LV_RESULT_OK;
+    if(w > (int32_t)buf->header.w || h > (int32_t)buf->header.h) return LV_RESULT_INVALID;
+
+    LV_PROFILER_DRAW_BEGIN;
+    stream_update(obj, &content_area);
+
+    lv_draw_image_dsc_t img_dsc;
+    lv_draw_image_dsc_init(&img_dsc);
+    img_dsc.base.layer = layer;
+    img_dsc.src = buf;
+
+    /*The columns right to `stream_ofs` are the left side of the plot and the others follow them*/
+    const lv_area_t clip_area_ori = layer->_clip_area;
+    int32_t i;
+    for(i = 0; i < 2; i++) {
+        lv_area_t img_area;
+        img_area.x1 = content_area.x1 - chart->stream_ofs + i * w;
+        img_area.y1 = content_area.y1;
+        img_area.x2 = img_area.x1 + buf->header.w - 1;
+        img_area.y2 = img_area.y1 + buf->header.h - 1;
+
+        lv_area_t part_area = content_area;
+        if(i == 0) part_area.x2 = content_area.x2 - chart->stream_ofs;
+        else part_area.x1 = content_area.x2 - chart->stream_ofs + 1;
+
+        if(!lv_area_intersect(&layer->_clip_area, &clip_area_ori, &part_area)) continue;
+        lv_draw_image(layer, &img_dsc, &img_area);
+    }
+    layer->_clip_area = clip_area_ori;
+
+    /*The vertical division lines don't move with the data*/
+    if(chart->update_mode == LV_CHART_UPDATE_MODE_SHIFT) draw_div_lines(obj, layer, false, true);
+
+    LV_PROFILER_DRAW_END;
+    return LV_RESULT_OK;
+}
+
+/**
+ * Render the changed parts of the plot area into the stream buffer
+ * @param obj           pointer to a chart
+ * @param content_area  the content area of the chart
+ */
+static void stream_update(lv_obj_t * obj, const lv_area_t * content_area)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    int32_t w = lv_area_get_width(content_area);
+    int32_t h = lv_area_get_height(content_area);
+    int32_t point_w = lv_obj_get_style_width(obj, LV_PART_INDICATOR);
+    int32_t margin = lv_obj_get_style_line_width(obj, LV_PART_ITEMS) + point_w;
+
+    /*Find the common start point of the visible series*/
+    bool start_same = true;
+    uint32_t start_point = 0;
+    lv_chart_series_t * ser;
+    lv_chart_series_t * ser_first = NULL;
+    LV_LL_READ(&chart->series_ll, ser) {
+        if(ser->hidden) continue;
+        if(ser_first == NULL) {
+            ser_first = ser;
+            start_point = ser->start_point;
+        }
+        else if(ser->start_point != start_point) {
+            start_same = false;
+        }
+    }
+
+    /*Not all style changes are reported by LV_EVENT_STYLE_CHANGED so compare the used styles*/
+    uint32_t style_hash = stream_get_style_hash(obj);
+
+    if(chart->stream_valid && chart->stream_w == w && chart->stream_h == h && chart->stream_style_hash == style_hash) {
+        if(chart->update_mode == LV_CHART_UPDATE_MODE_CIRCULAR) {
+            if(chart->stream_dirty_x1 <= chart->stream_dirty_x2) {
+                stream_render(obj, content_area, chart->stream_dirty_x1, chart->stream_dirty_x2);
+                chart->stream_dirty_x1 = LV_COORD_MAX;
+                chart->stream_dirty_x2 = LV_COORD_MIN;
+            }
+            return;
+        }
+
+        /*Shift the ring if the points are at the same pixels as before*/
+        uint32_t shift_cnt = chart->stream_shift_cnt;
+        int32_t step = 0;
+        if(chart->point_cnt > 1 && (int32_t)chart->point_cnt < w && w % (int32_t)(chart->point_cnt - 1) == 0) {
+            step = w / (int32_t)(chart->point_cnt - 1);
+        }
+
+        if(shift_cnt == 0) return;
+        if(start_same && step > 0 && (int32_t)shift_cnt * step < w &&
+           (ser_first == NULL || start_point == (chart->stream_start + shift_cnt) % chart->point_cnt)) {
+            int32_t shift = (int32_t)shift_cnt * step;
+            chart->stream_ofs = (chart->stream_ofs + shift) % w;
+            chart->stream_start = start_point;
+            chart->stream_shift_cnt = 0;
+
+            /*The new points on the right and the line of the removed point on the left*/
+            stream_render(obj, content_area, w - shift - margin, w - 1);
+            stream_render(obj, content_area, 0, margin);
+            return;
+        }
+    }
+
+    chart->stream_w = w;
+    chart->stream_h = h;
+    chart->stream_style_hash = style_hash;
+    chart->stream_ofs = 0;
+    chart->stream_start = start_same ? start_point : 0;
+    chart->stream_shift_cnt = 0;
+    chart->stream_dirty_x1 = LV_COORD_MAX;
+    chart->stream_dirty_x2 = LV_COORD_MIN;
+    stream_render(obj, content_area, 0, w - 1);
+    chart->stream_valid = 1;
+}
+
+/**
+ * Render some columns of the plot area into the stream buffer
+ * @param obj           pointer to a chart
+ * @param content_area  the content area of the chart
+ * @param x1            the first column to render relative to the content area
+ * @param x2            the last column to render relative to the content area
+ */
+static void stream_render(lv_obj_t * obj, const lv_area_t * content_area, int32_t x1, int32_t x2)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    lv_draw_buf_t * buf = chart->stream_buf;
+    int32_t w = lv_area_get_width(content_area);
+
+    lv_area_t render_area = *content_area;
+    render_area.x1 = content_area->x1 + LV_MAX(x1, 0);
+    render_area.x2 = content_area->x1 + LV_MIN(x2, w - 1);
+    if(render_area.x1 > render_area.x2) return;
+
+    lv_draw_rect_dsc_t bg_dsc;
+    lv_draw_rect_dsc_init(&bg_dsc);
+    lv_obj_init_draw_rect_dsc(obj, LV_PART_MAIN, &bg_dsc);
+    bg_dsc.border_opa = LV_OPA_TRANSP;
+    bg_dsc.outline_opa = LV_OPA_TRANSP;
+    bg_dsc.shadow_opa = LV_OPA_TRANSP;
+
+    /*The area might be in two parts if it wraps around in the ring*/
+    int32_t i;
+    for(i = 0; i < 2; i++) {
+        lv_layer_t layer;
+        lv_layer_init(&layer);
+        layer.draw_buf = buf;
+        layer.color_format = buf->header.cf;
+        layer.buf_area.x1 = content_area->x1 - chart->stream_ofs + i * w;
+        layer.buf_area.y1 = content_area->y1;
+        layer.buf_area.x2 = layer.buf_area.x1 + w - 1;
+        layer.buf_area.y2 = content_area->y2;
+        if(!lv_area_intersect(&layer._clip_area, &render_area, &layer.buf_area)) continue;
+        layer.phy_clip_area = layer._clip_area;
+
+        lv_area_t buf_clear_area = layer._clip_area;
+        lv_area_move(&buf_clear_area, -layer.buf_area.x1, -layer.buf_area.y1);
+        lv_draw_buf_clear(buf, &buf_clear_area);
+
+        bg_dsc.base.layer = &layer;
+        lv_draw_rect(&layer, &bg_dsc, &obj->coords);
+        draw_div_lines(obj, &layer, true, chart->update_mode != LV_CHART_UPDATE_MODE_SHIFT);
+        if(lv_ll_is_empty(&chart->series_ll) == false) draw_series_line(obj, &layer);
+
+        while(layer.draw_task_head) {
+            lv_draw_dispatch_wait_for_request();
+            bool task_dispatched = lv_draw_dispatch_layer(lv_obj_get_display(obj), &layer);
+            if(!task_dispatched) {
+                lv_draw_wait_for_finish();
+                lv_draw_dispatch_request();
+            }
+        }
+    }
+}
+
+/**
+ * Mark the columns around a point to be rendered into the stream buffer again
+ * @param obj       pointer to a chart
+ * @param i         index of the changed point
+ */
+static void stream_invalidate_point(lv_obj_t * obj, uint32_t i)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    int32_t w = lv_obj_get_content_width(obj);
+
+    /*In crowded mode the lines of the points depend on the previous columns too*/
+    if(chart->update_mode != LV_CHART_UPDATE_MODE_CIRCULAR || chart->point_cnt < 2 ||
+       (int32_t)chart->point_cnt >= w) {
+        chart->stream_valid = 0;
+        return;
+    }
+
+    int32_t point_w = lv_obj_get_style_width(obj, LV_PART_INDICATOR);
+    int32_t margin = lv_obj_get_style_line_width(obj, LV_PART_ITEMS) + point_w;
+    int32_t x1 = i > 0 ? (w * (int32_t)(i - 1)) / (int32_t)(chart->point_cnt - 1) : 0;
+    int32_t x2 = i < chart->point_cnt - 1 ? (w * (int32_t)(i + 1)) / (int32_t)(chart->point_cnt - 1) : w;
+
+    chart->stream_dirty_x1 = LV_MIN(chart->stream_dirty_x1, x1 - margin);
+    chart->stream_dirty_x2 = LV_MAX(chart->stream_dirty_x2, x2 + margin);
+}
+
+/**
+ * Add a style value to an FNV-1a hash
+ * @param hash      the hash so far
+ * @param v         the value to add
+ * @return          the new hash
+ */
+static uint32_t stream_hash_add(uint32_t hash, uint32_t v)
+{
+    uint32_t i;
+    for(i = 0; i < 4; i++) {
+        hash = (hash ^ (v & 0xFF)) * 16777619U;
+        v >>= 8;
+    }
+    return hash;
+}
+
+/**
+ * Get a hash of the style properties used to render the stream buffer
+ * @param obj       pointer to a chart
+ * @return          FNV-1a hash of the style properties
+ */
+static uint32_t stream_get_style_hash(lv_obj_t * obj)
+{
+    uint32_t hash = 2166136261U;
+
+    /*Background*/
+    hash = stream_hash_add(hash, lv_obj_get_style_radius(obj, LV_PART_MAIN));
+    hash = stream_hash_add(hash, lv_color_to_u32(lv_obj_get_style_bg_color(obj, LV_PART_MAIN)));
+    hash = stream_hash_add(hash, lv_obj_get_style_bg_opa(obj, LV_PART_MAIN));
+    hash = stream_hash_add(hash, lv_color_to_u32(lv_obj_get_style_bg_grad_color(obj, LV_PART_MAIN)));
+    hash = stream_hash_add(hash, lv_obj_get_style_bg_grad_dir(obj, LV_PART_MAIN));
+    hash = stream_hash_add(hash, lv_obj_get_style_bg_main_stop(obj, LV_PART_MAIN));
+    hash = stream_hash_add(hash, lv_obj_get_style_bg_grad_stop(obj, LV_PART_MAIN));
+    hash = stream_hash_add(hash, lv_obj_get_style_bg_main_opa(obj, LV_PART_MAIN));
+    hash = stream_hash_add(hash, lv_obj_get_style_bg_grad_opa(obj, LV_PART_MAIN));
+    hash = stream_hash_add(hash, (uint32_t)(lv_uintptr_t)lv_obj_get_style_bg_grad(obj, LV_PART_MAIN));
+    hash = stream_hash_add(hash, (uint32_t)(lv_uintptr_t)lv_obj_get_style_bg_image_src(obj, LV_PART_MAIN));
+    hash = stream_hash_add(hash, lv_obj_get_style_bg_image_opa(obj, LV_PART_MAIN));
+
+    /*Division lines and series lines*/
+    lv_part_t line_parts[] = {LV_PART_MAIN, LV_PART_ITEMS};
+    uint32_t i;
+    for(i = 0; i < sizeof(line_parts) / sizeof(line_parts[0]); i++) {
+        lv_part_t part = line_parts[i];
+        hash = stream_hash_add(hash, lv_color_to_u32(lv_obj_get_style_line_color(obj, part)));
+        hash = stream_hash_add(hash, lv_obj_get_style_line_opa(obj, part));
+        hash = stream_hash_add(hash, lv_obj_get_style_line_width(obj, part));
+        hash = stream_hash_add(hash, lv_obj_get_style_line_dash_width(obj, part));
+        hash = stream_hash_add(hash, lv_obj_get_style_line_dash_gap(obj, part));
+        hash = stream_hash_add(hash, lv_obj_get_style_line_rounded(obj, part));
+    }
+    hash = stream_hash_add(hash, lv_obj_get_style_opa(obj, LV_PART_ITEMS));
+
+    /*Points*/
+    hash = stream_hash_add(hash, lv_obj_get_style_width(obj, LV_PART_INDICATOR));
+    hash = stream_hash_add(hash, lv_obj_get_style_height(obj, LV_PART_INDICATOR));
+    hash = stream_hash_add(hash, lv_obj_get_style_radius(obj, LV_PART_INDICATOR));
+    hash = stream_hash_add(hash, lv_obj_get_style_bg_opa(obj, LV_PART_INDICATOR));
+    hash = stream_hash_add(hash, lv_obj_get_style_border_width(obj, LV_PART_INDICATOR));
+    hash = stream_hash_add(hash, lv_color_to_u32(lv_obj_get_style_border_color(obj, LV_PART_INDICATOR)));
+    hash = stream_hash_add(hash, lv_obj_get_style_border_opa(obj, LV_PART_INDICATOR));
+    hash = stream_hash_add(hash, lv_obj_get_style_opa(obj, LV_PART_INDICATOR));
+
+    return hash;
+}
+
 #endif
@@ -118,6 +118,27 @@ void lv_chart_set_axis_max_value(lv_obj_t * obj, lv_chart_axis_t axis, int32_t m
  */
 void lv_chart_set_update_mode(lv_obj_t * obj, lv_chart_update_mode_t update_mode);
 
+/**
+ * Render the plot area of a line chart (background, division lines and series) into a buffer
+ * and update only the changed columns of it when new values are added.
+ * Redrawing the chart then only copies the buffer.
+ * - In `LV_CHART_UPDATE_MODE_CIRCULAR` only the columns around the changed points are redrawn
+ *   into the buffer and invalidated, like the sweep of an oscilloscope.
+ * - In `LV_CHART_UPDATE_MODE_SHIFT` the buffer is used as a ring, so only the columns of the
+ *   new points are drawn. It requires the content width to be a multiple of `point count - 1`
+ *   and the same number of new values in all series, else the whole plot is rendered again.
+ *   The vertical division lines are drawn above the series in this mode.
+ * @param obj       pointer to a chart object
+ * @param draw_buf  a draw buffer at least as large as the content area of the chart,
+ *                  ideally with the color format of the display, or NULL to not use a buffer
+ * @note            The buffer is not used if the chart is not `LV_CHART_TYPE_LINE`, it is scrolled,
+ *                  or its content area is larger than the buffer.
+ *                  The background of the chart should be opaque and the division lines and
+ *                  series are drawn only on the content area.
+ *                  The buffer is not freed when the chart is deleted.
+ */
+void lv_chart_set_stream_buffer(lv_obj_t * obj, lv_draw_buf_t * draw_buf);
+
 /**
  * Set the number of horizontal and vertical division lines
  * @param obj       pointer to a chart object
@@ -154,6 +175,13 @@ lv_chart_type_t lv_chart_get_type(const lv_obj_t * obj);
  */
 uint32_t lv_chart_get_point_count(const lv_obj_t * obj);
 
+/**
+ * Get the buffer the plot area is rendered into.
+ * @param obj       pointer to chart object
+ * @return          the buffer set by `lv_chart_set_stream_buffer()` or NULL
+ */
+lv_draw_buf_t * lv_chart_get_stream_buffer(const lv_obj_t * obj);
+
 /**
  * Get the current index of the x-axis start point in the data array
  * @param obj       pointer to a chart object
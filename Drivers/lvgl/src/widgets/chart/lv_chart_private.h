@@ -65,6 +65,17 @@ struct _lv_chart_t {
     uint32_t point_cnt;         /**< Number of points in all series */
     lv_chart_type_t type  : 3;  /**< Chart type */
     lv_chart_update_mode_t update_mode : 2;
+    uint32_t stream_valid : 1;  /**< 1: the plot area is rendered into `stream_buf` */
+
+    lv_draw_buf_t * stream_buf; /**< Buffer to render the plot area into to update it incrementally */
+    int32_t stream_w;           /**< Size of the content area when `stream_buf` was rendered */
+    int32_t stream_h;
+    uint32_t stream_style_hash; /**< Hash of the styles used when `stream_buf` was rendered */
+    int32_t stream_ofs;         /**< Column of `stream_buf` showing the left side of the plot (shift mode)*/
+    uint32_t stream_start;      /**< Start point of the series when `stream_buf` was updated (shift mode)*/
+    uint32_t stream_shift_cnt;  /**< Number of new points since `stream_buf` was updated (shift mode)*/
+    int32_t stream_dirty_x1;    /**< Changed columns of the plot area relative to the content area (circular mode)*/
+    int32_t stream_dirty_x2;
 };
 
 
@@ -746,6 +746,11 @@ static void lv_label_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
 
     if(!label->static_txt) lv_free(label->text);
     label->text = NULL;
+
+#if LV_LABEL_LINE_CACHE
+    lv_draw_label_line_cache_reset(&label->line_cache);
+    lv_draw_label_line_cache_reset(&label->size_line_cache);
+#endif
 }
 
 static void lv_label_event(const lv_obj_class_t * class_p, lv_event_t * e)
@@ -789,7 +794,18 @@ static void lv_label_event(const lv_obj_class_t * class_p, lv_event_t * e)
 
             uint32_t dot_begin = label->dot_begin;
             lv_label_revert_dots(obj);
-            lv_text_get_size(&label->size_cache, label->text, font, letter_space, line_space, w, flag);
+#if LV_LABEL_LINE_CACHE
+            /*Reuse the lines of the drawn text if they were wrapped the same way*/
+            lv_draw_label_line_cache_t * line_cache = &label->line_cache;
+            if(line_cache->max_width != w || line_cache->flag != flag) line_cache = &label->size_line_cache;
+            if(lv_draw_label_line_cache_update(line_cache, label->text, font, letter_space, w, flag) == LV_RESULT_OK) {
+                lv_draw_label_line_cache_get_size(line_cache, line_space, &label->size_cache);
+            }
+            else
+#endif
+            {
+                lv_text_get_size(&label->size_cache, label->text, font, letter_space, line_space, w, flag);
+            }
             lv_label_set_dots(obj, dot_begin);
 
             label->size_cache.y = LV_MIN(label->size_cache.y, lv_obj_get_style_max_height(obj, LV_PART_MAIN));
@@ -830,6 +846,10 @@ static void draw_main(lv_event_t * e)
         label_draw_dsc.hint = &label->hint;
     }
 #endif
+#if LV_LABEL_LINE_CACHE
+    /*The dots are written into the text so it's not the text the lines were calculated for*/
+    if(label->long_mode != LV_LABEL_LONG_MODE_DOTS) label_draw_dsc.line_cache = &label->line_cache;
+#endif
 
     label_draw_dsc.flag = flag;
     label_draw_dsc.base.layer = layer;
@@ -970,7 +990,16 @@ static void lv_label_refr_text(lv_obj_t * obj)
     lv_text_flag_t flag = get_label_flags(label);
 
     lv_label_revert_dots(obj);
-    lv_text_get_size(&size, label->text, font, letter_space, line_space, max_w, flag);
+#if LV_LABEL_LINE_CACHE
+    if(lv_draw_label_line_cache_update(&label->line_cache, label->text, font, letter_space, max_w,
+                                       flag) == LV_RESULT_OK) {
+        lv_draw_label_line_cache_get_size(&label->line_cache, line_space, &size);
+    }
+    else
+#endif
+    {
+        lv_text_get_size(&size, label->text, font, letter_space, line_space, max_w, flag);
+    }
     label->text_size = size;
 
     lv_obj_refresh_self_size(obj);
@@ -52,6 +52,11 @@ struct _lv_label_t {
     uint8_t invalid_size_cache : 1;     /**< 1: Recalculate size and update cache */
 
     lv_point_t text_size;
+
+#if LV_LABEL_LINE_CACHE
+    lv_draw_label_line_cache_t line_cache;      /**< Lines of the text wrapped to the content width*/
+    lv_draw_label_line_cache_t size_line_cache; /**< Lines of the text wrapped to the width used for the self size*/
+#endif
 };
 
 
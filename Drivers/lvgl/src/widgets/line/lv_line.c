@@ -15,6 +15,7 @@
 #include "../../misc/lv_math.h"
 #include "../../misc/lv_types.h"
 #include "../../draw/lv_draw.h"
+#include "../../stdlib/lv_mem.h"
 
 /*********************
  *      DEFINES
@@ -181,6 +182,26 @@ static inline lv_value_precise_t resolve_point_coord(lv_value_precise_t coord, i
     }
 }
 
+/**
+ * Get the coordinates of a point on the screen
+ * @param line      pointer to a line object
+ * @param id        index of the point
+ * @param w         width of the line object
+ * @param h         height of the line object
+ * @param x_ofs     x coordinate of the line's origin on the screen
+ * @param y_ofs     y coordinate of the line's origin on the screen
+ * @param p         store the result here
+ */
+static void resolve_point(const lv_line_t * line, uint32_t id, int32_t w, int32_t h, int32_t x_ofs, int32_t y_ofs,
+                          lv_point_precise_t * p)
+{
+    p->x = resolve_point_coord(line->point_array.constant[id].x, w) + x_ofs;
+    p->y = resolve_point_coord(line->point_array.constant[id].y, h);
+
+    if(line->y_inv == 0) p->y = p->y + y_ofs;
+    else p->y = h - p->y + y_ofs;
+}
+
 static void lv_line_event(const lv_obj_class_t * class_p, lv_event_t * e)
 {
     LV_UNUSED(class_p);
@@ -239,26 +260,34 @@ static void lv_line_event(const lv_obj_class_t * class_p, lv_event_t * e)
         line_dsc.base.layer = layer;
         lv_obj_init_draw_line_dsc(obj, LV_PART_MAIN, &line_dsc);
 
-        /*Read all points and draw the lines*/
+        int32_t w = lv_obj_get_width(obj);
+        int32_t h = lv_obj_get_height(obj);
         uint32_t i;
-        for(i = 0; i < line->point_num - 1; i++) {
-            int32_t w = lv_obj_get_width(obj);
-            int32_t h = lv_obj_get_height(obj);
 
-            line_dsc.p1.x = resolve_point_coord(line->point_array.constant[i].x, w) + x_ofs;
-            line_dsc.p1.y = resolve_point_coord(line->point_array.constant[i].y, h);
-
-            line_dsc.p2.x = resolve_point_coord(line->point_array.constant[i + 1].x, w) + x_ofs;
-            line_dsc.p2.y = resolve_point_coord(line->point_array.constant[i + 1].y, h);
-
-            if(line->y_inv == 0) {
-                line_dsc.p1.y = line_dsc.p1.y + y_ofs;
-                line_dsc.p2.y = line_dsc.p2.y + y_ofs;
-            }
-            else {
-                line_dsc.p1.y = h - line_dsc.p1.y + y_ofs;
-                line_dsc.p2.y = h - line_dsc.p2.y + y_ofs;
+#if LV_USE_DRAW_SW && LV_DRAW_SW_POLYLINE
+        /*Draw all lines in one draw task if the tasks of the segments are not needed in the draw task events*/
+        if(line->point_num >= 2 && !lv_obj_has_flag(obj, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS)) {
+            lv_point_precise_t * points = lv_malloc(line->point_num * sizeof(lv_point_precise_t));
+            LV_ASSERT_MALLOC(points);
+            if(points) {
+                for(i = 0; i < line->point_num; i++) {
+                    resolve_point(line, i, w, h, x_ofs, y_ofs, &points[i]);
+                }
+
+                /*The draw task takes over the points*/
+                line_dsc.points = points;
+                line_dsc.point_cnt = line->point_num;
+                line_dsc.points_owned = 1;
+                lv_draw_line(layer, &line_dsc);
+                return;
             }
+        }
+#endif
+
+        /*Read all points and draw the lines*/
+        for(i = 0; i < line->point_num - 1; i++) {
+            resolve_point(line, i, w, h, x_ofs, y_ofs, &line_dsc.p1);
+            resolve_point(line, i + 1, w, h, x_ofs, y_ofs, &line_dsc.p2);
 
             lv_draw_line(layer, &line_dsc);
             line_dsc.round_start = 0;   /*Draw the rounding only on the end points after the first line*/
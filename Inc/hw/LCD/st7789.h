@@ -7,8 +7,11 @@
 
 /*----------------------------------------------- 参数宏 -------------------------------------------*/
 
-#define LCD_Width     240		// LCD的像素长度
-#define LCD_Height    240		// LCD的像素宽度
+#define LCD_Width     240		// 默认屏幕 hlcd1 的像素长度
+#define LCD_Height    240		// 默认屏幕 hlcd1 的像素宽度
+#define LCD_MemoryHeight 320	// 控制器显存的行数，硬件滚动和翻转显示时用到
+
+#define LCD_MAX_PANELS 2		// 最多可以同时使用的屏幕个数
 
 // 显示方向参数
 // 使用示例：LCD_DisplayDirection(Direction_H) 设置屏幕横屏显示
@@ -17,6 +20,21 @@
 #define	Direction_V				2					//LCD竖屏显示
 #define	Direction_V_Flip	   3					//LCD竖屏显示,上下翻转
 
+// 传输的像素格式参数，即 COLMOD 指令的参数
+// 使用示例：LCD_SetPixelFormat(LCD_Format_RGB444) 设置为12位色传输，少传输25%的数据
+#define	LCD_Format_RGB444		0x03				//12位色，2个像素3个字节
+#define	LCD_Format_RGB565		0x05				//16位色，每个像素2个字节
+#define	LCD_Format_RGB666		0x06				//18位色，每个像素3个字节
+
+// TE（撕裂效应）同步方式
+// 使用示例：LCD_TE_SetMode(LCD_TE_Mode_Beam) 跟随扫描线写入
+#define	LCD_TE_Mode_Off		0				//不同步，立即写入
+#define	LCD_TE_Mode_Vsync		1				//每帧等到TE信号之后再开始写入
+#define	LCD_TE_Mode_Beam		2				//选择写入的时机，使写入的位置不和扫描线交叉
+
+// TE同步时，写入位置和扫描线之间至少间隔的行数，用于抵消刷新周期和消隐时间的误差
+#define	LCD_TE_GUARD_LINES	8
+
 // 设置变量显示时多余位补0还是补空格
 // 只有 LCD_DisplayNumber() 显示整数 和 LCD_DisplayDecimals()显示小数 这两个函数用到
 // 使用示例： LCD_ShowNumMode(Fill_Zero) 设置多余位填充0，例如 123 可以显示为 000123
@@ -57,9 +75,85 @@
 #define 	DARK_YELLOW     0x808000    //	暗黄色
 #define 	DARK_GREY       0x404040    //	暗灰色
 
+/*------------------------------------------------ 屏幕句柄 ----------------------------------------------
+
+ 1. 每个屏幕对应一个句柄，包括屏幕连接的SPI、引脚、分辨率，以及画笔色、字体、显示方向等运行参数
+ 2. 默认的屏幕是 hlcd1，只有一个屏幕时不需要关心句柄，直接调用 SPI_LCD_Init() 和各个绘图函数即可
+ 3. 多个屏幕时，填写好句柄的硬件连接之后调用 LCD_Init()，再用 LCD_Select() 选择之后的函数操作哪个屏幕
+ 4. 不同屏幕接在不同的SPI上，并且SPI配置了DMA时，LCD_CopyBuffer_DMA() 可以同时向多个屏幕传输
+ */
+
+// TE（撕裂效应）信号相关参数，时间都是 DWT 的计数值，即内核时钟周期数
+typedef struct
+{
+   volatile uint32_t Last_Time;     // 最近一次TE信号的时间
+   volatile uint32_t Period;        // 刷新周期，多次测量的平均值
+   volatile uint32_t Count;         // 收到的TE信号个数
+   uint8_t  Mode;                   // 同步方式
+   uint32_t Byte_Time;              // 传输一个字节的时间，单位是 1/256 个时钟周期，每次写入显存之后更新
+   uint8_t  Frame_First;            // 下一次 LCD_CopyBuffer() 是一帧的第一个区域
+   uint8_t  Frame_Valid;            // 上一帧的写入位置和时间可以用来估计这一帧
+   int16_t  Frame_First_Line;       // 这一帧开始写入的扫描行
+   int16_t  Frame_Last_Line;        // 最近写入的扫描行
+   uint32_t Frame_Write_Start;      // 这一帧开始写入的时间
+   uint32_t Frame_Write_End;        // 最近一次写入结束的时间
+   int32_t  Frame_Lines;            // 上一帧写入位置移动的行数，向下为正
+   uint32_t Frame_Duration;         // 上一帧写入的时间
+   uint32_t Frame_Start;            // 当前帧开始的时间
+   uint32_t Frame_Count;            // 帧数
+   uint64_t Frame_Time_Sum;         // 帧间隔的总和
+   uint32_t Frame_Time_Max;         // 最大帧间隔
+   uint64_t Wait_Time;              // 等待扫描线或TE信号的总时间
+   uint32_t Unsafe_Count;           // 无法避开扫描线的次数
+}LCD_TE_TypeDef;
+
+typedef struct __LCD_HandleTypeDef
+{
+// 硬件连接，调用 LCD_Init() 之前填写
+   SPI_HandleTypeDef *hspi;         // 屏幕连接的SPI，CS使用SPI的硬件片选
+   GPIO_TypeDef *DC_Port;           // 数据指令选择 GPIO端口
+   uint16_t      DC_Pin;            // 数据指令选择 引脚
+   GPIO_TypeDef *Backlight_Port;    // 背光 GPIO端口
+   uint16_t      Backlight_Pin;     // 背光 引脚
+   GPIO_TypeDef *TE_Port;           // TE信号 GPIO端口，没有连接TE引脚时为 NULL
+   uint16_t      TE_Pin;            // TE信号 引脚
+   IRQn_Type     TE_IRQn;           // TE信号 外部中断
+   uint16_t      Panel_Width;       // 竖屏时的像素长度
+   uint16_t      Panel_Height;      // 竖屏时的像素宽度
+
+// DMA传输完成的回调函数，在SPI的中断里调用
+   void (*TxCpltCallback)(struct __LCD_HandleTypeDef *hlcd);
+   void *User_Data;                 // 用户数据，驱动不使用
+
+// 以下是驱动的运行参数，由驱动修改
+   volatile uint8_t Busy;           // 正在DMA传输
+   uint32_t DMA_Start;              // 开始DMA传输的时间
+   uint32_t DMA_Bytes;              // DMA传输的字节数
+   pFONT   *AsciiFonts;             // 英文字体，ASCII字符集
+   pFONT   *CHFonts;                // 中文字体（同时也包含英文字体）
+   uint32_t Color;  				      //	LCD当前画笔颜色
+   uint32_t BackColor;			      //	背景色
+   uint8_t  ShowNum_Mode;		      // 数字显示模式
+   uint8_t  Direction;			      //	显示方向
+   uint8_t  Pixel_Format;           // 传输的像素格式
+   uint16_t Width;                  // 屏幕像素长度
+   uint16_t Height;                 // 屏幕像素宽度
+   uint16_t X_Offset;               // X坐标偏移，用于设置屏幕控制器的显存写入方式
+   uint16_t Y_Offset;               // Y坐标偏移，用于设置屏幕控制器的显存写入方式
+   uint16_t Scroll_Top;             // 硬件滚动区域的起始行（屏幕坐标）
+   uint16_t Scroll_Height;          // 硬件滚动区域的行数，为0时不滚动
+   uint16_t Scroll_Start;           // 滚动区域第一行显示的是滚动区域内的第几行
+   LCD_TE_TypeDef TE;               // TE信号相关参数
+}LCD_HandleTypeDef;
+
+extern LCD_HandleTypeDef hlcd1;     // 默认的屏幕，使用SPI6和文件末尾定义的引脚
+
 /*------------------------------------------------ 函数声明 ----------------------------------------------*/
 
-void  SPI_LCD_Init(void);      // 液晶屏以及SPI初始化
+void  SPI_LCD_Init(void);      // 初始化默认的屏幕 hlcd1
+HAL_StatusTypeDef LCD_Init(LCD_HandleTypeDef *hlcd);		// 初始化屏幕，并选择这个屏幕，屏幕超过 LCD_MAX_PANELS 个时返回 HAL_ERROR
+void  LCD_Select(LCD_HandleTypeDef *hlcd);	// 选择之后的函数操作的屏幕
+LCD_HandleTypeDef *LCD_GetSelected(void);		// 获取当前操作的屏幕
 void  LCD_Clear(void);			 // 清屏函数
 void LCD_FramClear(uint16_t* DataFrameBuff);
 void  LCD_ClearRect(uint16_t x, uint16_t y, uint16_t width, uint16_t height);	// 局部清屏函数
@@ -68,6 +162,35 @@ void  LCD_SetAddress(uint16_t x1,uint16_t y1,uint16_t x2,uint16_t y2);	// 设置
 void  LCD_SetColor(uint32_t Color); 				   //	设置画笔颜色
 void  LCD_SetBackColor(uint32_t Color);  				//	设置背景颜色
 void  LCD_SetDirection(uint8_t direction);  	      //	设置显示方向
+void  LCD_SetPixelFormat(uint8_t format);				//	设置传输的像素格式
+uint8_t LCD_GetPixelFormat(void);							//	获取传输的像素格式
+
+//>>>>>	硬件垂直滚动
+HAL_StatusTypeDef LCD_SetScrollArea(uint16_t top_fixed, uint16_t bottom_fixed);	// 设置滚动区域
+void  LCD_SetScrollStart(uint16_t line);		// 设置滚动起始行
+uint16_t LCD_GetScrollStart(void);				// 获取滚动起始行
+void  LCD_ScrollOff(void);							// 退出滚动
+
+//>>>>>	TE（撕裂效应）同步，时间单位都是us
+typedef struct
+{
+   uint32_t TE_Count;         // 收到的TE信号个数
+   uint32_t Period;           // 刷新周期
+   uint32_t Frame_Count;      // LCD_TE_FrameStart() 统计的帧数
+   uint32_t Frame_Time;       // 平均帧间隔
+   uint32_t Frame_Time_Max;   // 最大帧间隔
+   uint32_t Wait_Time;        // 等待扫描线或TE信号的总时间
+   uint32_t Unsafe_Count;     // 无法避开扫描线的次数，这些帧或区域可能会撕裂
+}LCD_TE_StatsTypeDef;
+
+void  LCD_TE_On(void);								// 打开TE信号
+void  LCD_TE_Off(void);								// 关闭TE信号
+void  LCD_TE_Callback(LCD_HandleTypeDef *hlcd);	// 在TE引脚的外部中断里调用
+uint16_t LCD_TE_GetScanLine(void);				// 估计当前扫描到的行
+void  LCD_TE_SetMode(uint8_t mode);				// 设置同步方式
+void  LCD_TE_FrameStart(void);					// 一帧开始写入之前调用
+void  LCD_TE_GetStats(LCD_TE_StatsTypeDef *stats);	// 获取帧间隔等统计结果
+void  LCD_TE_ResetStats(void);					// 清除统计结果
 
 //>>>>>	显示ASCII字符
 void  LCD_SetAsciiFont(pFONT *fonts);										//	设置ASCII字体
@@ -105,10 +228,15 @@ void 	LCD_DrawImage(uint16_t x,uint16_t y,uint16_t width,uint16_t height,const u
 
 //>>>>>	批量复制函数，直接将数据复制到屏幕的显存
 void	LCD_CopyBuffer(uint16_t x, uint16_t y,uint16_t width,uint16_t height,uint16_t *DataBuff);
+HAL_StatusTypeDef LCD_CopyBuffer_DMA(uint16_t x, uint16_t y,uint16_t width,uint16_t height,uint16_t *DataBuff);	// DMA传输，不等待完成
+void  LCD_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi);	// 在 HAL_SPI_TxCpltCallback() 中调用
+void  LCD_WaitIdle(void);									// 等待DMA传输完成
 void LCD_DisPlayAll(uint16_t* LCD_FrameBuff);
 
 /*--------------------------------------------- LCD其它引脚 -----------------------------------------------*/
 
+// 以下是默认屏幕 hlcd1 的引脚，其它屏幕的引脚在句柄中填写
+
 #define  LCD_Backlight_PIN								GPIO_PIN_12				         // 背光  引脚
 #define	LCD_Backlight_PORT							GPIOG									// 背光 GPIO端口
 #define 	GPIO_LDC_Backlight_CLK_ENABLE        	__HAL_RCC_GPIOG_CLK_ENABLE()	// 背光 GPIO时钟
@@ -120,8 +248,10 @@ void LCD_DisPlayAll(uint16_t* LCD_FrameBuff);
 #define	LCD_DC_PORT						GPIOG									// 数据指令选择  GPIO端口
 #define 	GPIO_LDC_DC_CLK_ENABLE     __HAL_RCC_GPIOG_CLK_ENABLE()	// 数据指令选择  GPIO时钟
 
-#define	LCD_DC_Command		   HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_RESET);	   // 低电平，指令传输
-#define 	LCD_DC_Data		      HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_SET);		// 高电平，数据传输
+#define  LCD_TE_PIN						GPIO_PIN_11				         // TE（撕裂效应）信号  引脚，根据实际连线修改
+#define	LCD_TE_PORT						GPIOG									// TE信号 GPIO端口
+#define 	GPIO_LDC_TE_CLK_ENABLE     __HAL_RCC_GPIOG_CLK_ENABLE()	// TE信号 GPIO时钟
+#define 	LCD_TE_IRQn						EXTI15_10_IRQn						// TE信号 外部中断
 
 #endif //__spi_lcd
 
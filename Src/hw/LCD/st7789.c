@@ -30,36 +30,49 @@
 
 extern SPI_HandleTypeDef hspi6;			// SPI_HandleTypeDef 结构体变量
 
-#define  LCD_SPI hspi6           // SPI局部宏，方便修改和移植
+#define  LCD_SPI (*LCD->hspi)     // 当前屏幕的SPI
 
-static pFONT *LCD_AsciiFonts;		// 英文字体，ASCII字符集
-static pFONT *LCD_CHFonts;		   // 中文字体（同时也包含英文字体）
+// 当前屏幕的 数据指令选择 引脚
+#define	LCD_DC_Command		   HAL_GPIO_WritePin(LCD->DC_Port, LCD->DC_Pin, GPIO_PIN_RESET);	   // 低电平，指令传输
+#define 	LCD_DC_Data		      HAL_GPIO_WritePin(LCD->DC_Port, LCD->DC_Pin, GPIO_PIN_SET);		// 高电平，数据传输
+
+// 默认的屏幕，使用 st7789.h 中定义的引脚和 SPI6
+LCD_HandleTypeDef hlcd1 =
+{
+   .hspi           = &hspi6,
+   .DC_Port        = LCD_DC_PORT,
+   .DC_Pin         = LCD_DC_PIN,
+   .Backlight_Port = LCD_Backlight_PORT,
+   .Backlight_Pin  = LCD_Backlight_PIN,
+   .TE_Port        = LCD_TE_PORT,
+   .TE_Pin         = LCD_TE_PIN,
+   .TE_IRQn        = LCD_TE_IRQn,
+   .Panel_Width    = LCD_Width,
+   .Panel_Height   = LCD_Height,
+};
+
+static LCD_HandleTypeDef *LCD = &hlcd1;                     // 当前操作的屏幕，用 LCD_Select() 切换
+static LCD_HandleTypeDef *LCD_Panels[LCD_MAX_PANELS];       // 已经初始化的屏幕，DMA传输完成时用来查找屏幕
 
 // 因为这类SPI的屏幕，每次更新显示时，需要先配置坐标区域、再写显存，
 // 在显示字符时，如果是一个个点去写坐标写显存，会非常慢，
 // 因此开辟一片缓冲区，先将需要显示的数据写进缓冲区，最后再批量写入显存。
 // 用户可以根据实际情况去修改此处缓冲区的大小，
 // 例如，用户需要显示32*32的汉字时，需要的大小为 32*32*2 = 2048 字节（每个像素点占2字节）
+// 缓冲区只在阻塞传输时使用，多个屏幕可以共用
 uint16_t  LCD_Buff[1024];        // LCD缓冲区，16位宽（每个像素点占2字节）
 
-
-
-struct	//LCD相关参数结构体
-{
-	uint32_t Color;  				//	LCD当前画笔颜色
-	uint32_t BackColor;			//	背景色
-   uint8_t  ShowNum_Mode;		// 数字显示模式
-	uint8_t  Direction;			//	显示方向
-   uint16_t Width;            // 屏幕像素长度
-   uint16_t Height;           // 屏幕像素宽度
-   uint8_t  X_Offset;         // X坐标偏移，用于设置屏幕控制器的显存写入方式
-   uint8_t  Y_Offset;         // Y坐标偏移，用于设置屏幕控制器的显存写入方式
-}LCD;
+// RGB444 和 RGB666 格式传输时，先把 RGB565 的数据分批打包到这个缓冲区再发送，
+// 大小为3的倍数，RGB444 每3个16位数据是4个像素，RGB666 每3个16位数据是2个像素
+static uint16_t  LCD_PackBuff[768];
 
 // 该函数修改于HAL的SPI库函数，专为 LCD_Clear() 清屏函数修改，
 // 目的是为了SPI传输数据不限数据长度的写入
 HAL_StatusTypeDef LCD_SPI_Transmit(SPI_HandleTypeDef *hspi, uint16_t pData, uint32_t Size);
 HAL_StatusTypeDef LCD_SPI_TransmitBuffer (SPI_HandleTypeDef *hspi, uint16_t *pData, uint32_t Size);
+static void LCD_CopyRows(uint16_t x, uint16_t y,uint16_t width,uint16_t height,uint16_t *DataBuff);
+static void LCD_WritePacked(uint16_t *DataBuff, uint32_t count);
+static void LCD_TE_WaitArea(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint32_t bytes);
 
 
 /*****************************************************************************************
@@ -72,6 +85,8 @@ HAL_StatusTypeDef LCD_SPI_TransmitBuffer (SPI_HandleTypeDef *hspi, uint16_t *pDa
 
 void  LCD_WriteCommand(uint8_t lcd_command)
 {
+   LCD_WaitIdle();     // 每次操作屏幕都从指令开始，等待之前的DMA传输完成
+
    LCD_DC_Command;     // 数据指令选择 引脚输出低电平，代表本次传输 指令
 
    HAL_SPI_Transmit(&LCD_SPI, &lcd_command, 1, 1000) ;
@@ -140,19 +155,56 @@ void  LCD_WriteBuff(uint16_t *DataBuff, uint16_t DataSize)
 /****************************************************************************************************************************************
 *	函 数 名: SPI_LCD_Init
 *
-*	函数功能: 初始化SPI以及屏幕控制器的各种参数
+*	函数功能: 初始化默认的屏幕 hlcd1
 *
 ****************************************************************************************************************************************/
 
 void SPI_LCD_Init(void)
 {
+   LCD_Init(&hlcd1);
+}
+
+/****************************************************************************************************************************************
+*	函 数 名: LCD_Init
+*
+*	入口参数: hlcd - 屏幕句柄，需要先填写好 SPI、引脚和分辨率
+*
+*	返 回 值: HAL_OK - 初始化完成
+*				 HAL_ERROR - 已经初始化了 LCD_MAX_PANELS 个其它屏幕，不做任何操作
+*
+*	函数功能: 初始化屏幕控制器的各种参数，并选择这个屏幕
+*
+*	说    明: 1. SPI 和引脚需要先由 CubeMX 生成的代码初始化，CS 使用 SPI 的硬件片选
+*				 2. 最多可以初始化 LCD_MAX_PANELS 个屏幕，之后用 LCD_Select() 切换要操作的屏幕
+*
+****************************************************************************************************************************************/
+
+HAL_StatusTypeDef LCD_Init(LCD_HandleTypeDef *hlcd)
+{
+   uint8_t i;
+
+   for(i = 0; i < LCD_MAX_PANELS; i++)    // 记录屏幕，DMA传输完成时根据SPI查找
+   {
+      if( LCD_Panels[i] == hlcd )  break;
+      if( LCD_Panels[i] == NULL )
+      {
+         LCD_Panels[i] = hlcd;
+         break;
+      }
+   }
+   if( i == LCD_MAX_PANELS )     // 没有空位，DMA传输完成时会找不到这个屏幕
+   {
+      return HAL_ERROR;
+   }
+
+   LCD_Select(hlcd);
+
 
    HAL_Delay(10);               // 屏幕刚完成复位时（包括上电复位），需要等待5ms才能发送指令
  	LCD_WriteCommand(0x36);       // 显存访问控制 指令，用于设置访问显存的方式
 	LCD_WriteData_8bit(0x00);     // 配置成 从上到下、从左到右，RGB像素格式
 
-	LCD_WriteCommand(0x3A);			// 接口像素格式 指令，用于设置使用 12位、16位还是18位色
-	LCD_WriteData_8bit(0x05);     // 此处配置成 16位 像素格式
+	LCD_SetPixelFormat(LCD_Format_RGB565);     // 接口像素格式，此处配置成 16位 像素格式
 
 // 接下来很多都是电压设置指令，直接使用厂家给设定值
  	LCD_WriteCommand(0xB2);
@@ -240,8 +292,37 @@ void SPI_LCD_Init(void)
 	// LCD_FramClear(FrameBuffer);
 	// LCD_DisPlayAll(FrameBuffer);
 // 全部设置完毕之后，打开背光
-   LCD_Backlight_ON;  // 引脚输出高电平点亮背光
+   HAL_GPIO_WritePin(LCD->Backlight_Port, LCD->Backlight_Pin, GPIO_PIN_SET);  // 引脚输出高电平点亮背光
 
+   return HAL_OK;
+}
+
+/****************************************************************************************************************************************
+*	函 数 名: LCD_Select
+*
+*	入口参数: hlcd - 屏幕句柄
+*
+*	函数功能: 选择要操作的屏幕，之后调用的函数都作用于这个屏幕
+*
+*	说    明: 不同屏幕的画笔色、字体、显示方向等参数是分开保存的，切换屏幕之后不需要重新设置
+*
+****************************************************************************************************************************************/
+
+void LCD_Select(LCD_HandleTypeDef *hlcd)
+{
+   LCD = hlcd;
+}
+
+/****************************************************************************************************************************************
+*	函 数 名: LCD_GetSelected
+*
+*	返 回 值: 当前操作的屏幕
+*
+****************************************************************************************************************************************/
+
+LCD_HandleTypeDef *LCD_GetSelected(void)
+{
+   return LCD;
 }
 
 // void LCD_FramClear(uint16_t* DataFrameBuff){
@@ -260,12 +341,12 @@ void SPI_LCD_Init(void)
 void LCD_SetAddress(uint16_t x1,uint16_t y1,uint16_t x2,uint16_t y2)
 {
 	LCD_WriteCommand(0x2a);			//	列地址设置，即X坐标
-	LCD_WriteData_16bit(x1+LCD.X_Offset);
-	LCD_WriteData_16bit(x2+LCD.X_Offset);
+	LCD_WriteData_16bit(x1+LCD->X_Offset);
+	LCD_WriteData_16bit(x2+LCD->X_Offset);
 
 	LCD_WriteCommand(0x2b);			//	行地址设置，即Y坐标
-	LCD_WriteData_16bit(y1+LCD.Y_Offset);
-	LCD_WriteData_16bit(y2+LCD.Y_Offset);
+	LCD_WriteData_16bit(y1+LCD->Y_Offset);
+	LCD_WriteData_16bit(y2+LCD->Y_Offset);
 
 	LCD_WriteCommand(0x2c);			//	开始写入显存，即要显示的颜色数据
 }
@@ -290,7 +371,7 @@ void LCD_SetColor(uint32_t Color)
 	Green_Value = (uint16_t)((Color&0x0000FC00)>>5);
 	Blue_Value  = (uint16_t)((Color&0x000000F8)>>3);
 
-	LCD.Color = (uint16_t)(Red_Value | Green_Value | Blue_Value);  // 将颜色写入全局LCD参数
+	LCD->Color = (uint16_t)(Red_Value | Green_Value | Blue_Value);  // 将颜色写入全局LCD参数
 }
 
 /****************************************************************************************************************************************
@@ -313,7 +394,7 @@ void LCD_SetBackColor(uint32_t Color)
 	Green_Value = (uint16_t)((Color&0x0000FC00)>>5);
 	Blue_Value  = (uint16_t)((Color&0x000000F8)>>3);
 
-	LCD.BackColor = (uint16_t)(Red_Value | Green_Value | Blue_Value);	// 将颜色写入全局LCD参数
+	LCD->BackColor = (uint16_t)(Red_Value | Green_Value | Blue_Value);	// 将颜色写入全局LCD参数
 }
 
 /****************************************************************************************************************************************
@@ -330,46 +411,574 @@ void LCD_SetBackColor(uint32_t Color)
 
 void LCD_SetDirection(uint8_t direction)
 {
-	LCD.Direction = direction;    // 写入全局LCD参数
+   if( LCD->Scroll_Height != 0 )  // 不同方向下滚动区域对应的显存行不同，先退出滚动
+   {
+      LCD_ScrollOff();
+   }
+
+	LCD->Direction = direction;    // 写入全局LCD参数
 
    if( direction == Direction_H )   // 横屏显示
    {
       LCD_WriteCommand(0x36);    		// 显存访问控制 指令，用于设置访问显存的方式
       LCD_WriteData_8bit(0x70);        // 横屏显示
-      LCD.X_Offset   = 0;             // 设置控制器坐标偏移量
-      LCD.Y_Offset   = 0;
-      LCD.Width      = LCD_Height;		// 重新赋值长、宽
-      LCD.Height     = LCD_Width;
+      LCD->X_Offset   = 0;             // 设置控制器坐标偏移量
+      LCD->Y_Offset   = 0;
+      LCD->Width      = LCD->Panel_Height;		// 重新赋值长、宽
+      LCD->Height     = LCD->Panel_Width;
    }
    else if( direction == Direction_V )
    {
       LCD_WriteCommand(0x36);    		// 显存访问控制 指令，用于设置访问显存的方式
       LCD_WriteData_8bit(0x00);        // 垂直显示
-      LCD.X_Offset   = 0;              // 设置控制器坐标偏移量
-      LCD.Y_Offset   = 0;
-      LCD.Width      = LCD_Width;		// 重新赋值长、宽
-      LCD.Height     = LCD_Height;
+      LCD->X_Offset   = 0;              // 设置控制器坐标偏移量
+      LCD->Y_Offset   = 0;
+      LCD->Width      = LCD->Panel_Width;		// 重新赋值长、宽
+      LCD->Height     = LCD->Panel_Height;
    }
    else if( direction == Direction_H_Flip )
    {
       LCD_WriteCommand(0x36);   			 // 显存访问控制 指令，用于设置访问显存的方式
       LCD_WriteData_8bit(0xA0);         // 横屏显示，并上下翻转，RGB像素格式
-      LCD.X_Offset   = 80;              // 设置控制器坐标偏移量
-      LCD.Y_Offset   = 0;
-      LCD.Width      = LCD_Height;		 // 重新赋值长、宽
-      LCD.Height     = LCD_Width;
+      LCD->X_Offset   = LCD_MemoryHeight - LCD->Panel_Height;   // 设置控制器坐标偏移量，翻转后屏幕对应显存的末尾
+      LCD->Y_Offset   = 0;
+      LCD->Width      = LCD->Panel_Height;		 // 重新赋值长、宽
+      LCD->Height     = LCD->Panel_Width;
    }
    else if( direction == Direction_V_Flip )
    {
       LCD_WriteCommand(0x36);    		// 显存访问控制 指令，用于设置访问显存的方式
       LCD_WriteData_8bit(0xC0);        // 垂直显示 ，并上下翻转，RGB像素格式
-      LCD.X_Offset   = 0;              // 设置控制器坐标偏移量
-      LCD.Y_Offset   = 80;
-      LCD.Width      = LCD_Width;		// 重新赋值长、宽
-      LCD.Height     = LCD_Height;
+      LCD->X_Offset   = 0;              // 设置控制器坐标偏移量
+      LCD->Y_Offset   = LCD_MemoryHeight - LCD->Panel_Height;
+      LCD->Width      = LCD->Panel_Width;		// 重新赋值长、宽
+      LCD->Height     = LCD->Panel_Height;
+   }
+}
+
+
+/****************************************************************************************************************************************
+*	函 数 名:	LCD_SetPixelFormat
+*
+*	入口参数:	format - 传输的像素格式，可选 LCD_Format_RGB565、LCD_Format_RGB444、LCD_Format_RGB666
+*
+*	函数功能:	设置 SPI 传输的像素格式，即 12位、16位还是18位色
+*
+*	说    明:	1. 显存内部始终是18位色，切换格式不会改变已经显示的内容，之后写入的数据按新的格式解析
+*					2. 只有 LCD_CopyBuffer() 会把 RGB565 的数据转换为设置的格式，其它绘图函数需要 RGB565 格式
+*					3. RGB444 每个像素只需要传输12位，比 RGB565 少传输25%的数据，适合对画质要求不高的界面
+*					4. RGB666 每个像素需要传输3个字节，RGB565 的数据转换之后不会更清晰，用于需要18位数据的场合
+*
+*****************************************************************************************************************************************/
+
+void LCD_SetPixelFormat(uint8_t format)
+{
+	LCD_WriteCommand(0x3A);			// 接口像素格式 指令
+	LCD_WriteData_8bit(format);
+
+   LCD->Pixel_Format = format;
+}
+
+/****************************************************************************************************************************************
+*	函 数 名:	LCD_GetPixelFormat
+*
+*	返 回 值:	当前传输的像素格式
+*
+*****************************************************************************************************************************************/
+
+uint8_t LCD_GetPixelFormat(void)
+{
+   return LCD->Pixel_Format;
+}
+
+/****************************************************************************************************************************************
+*	函 数 名:	LCD_SetScrollArea
+*
+*	入口参数:	top_fixed    - 顶部固定区域的行数
+*					bottom_fixed - 底部固定区域的行数
+*
+*	返 回 值:	HAL_OK - 设置成功，HAL_ERROR - 参数错误或者当前显示方向不支持
+*
+*	函数功能:	设置硬件垂直滚动区域，顶部和底部固定区域之间的行为滚动区域
+*
+*	说    明:	1. 只支持竖屏显示 Direction_V 和 Direction_V_Flip，横屏时控制器的滚动方向是屏幕的水平方向
+*					2. 设置之后滚动起始行为0，即显示的内容和未滚动时一样
+*					3. 滚动时 LCD_CopyBuffer() 会把屏幕的行转换为显存的行，其它绘图函数直接写入显存的行
+*				   4. 使用示例 LCD_SetScrollArea( 20, 0) ，顶部20行固定，剩下的220行可以滚动
+*
+*****************************************************************************************************************************************/
+
+HAL_StatusTypeDef LCD_SetScrollArea(uint16_t top_fixed, uint16_t bottom_fixed)
+{
+   uint16_t scroll_height;
+
+   if( LCD->Direction != Direction_V && LCD->Direction != Direction_V_Flip )
+   {
+      return HAL_ERROR;
+   }
+   if( top_fixed + bottom_fixed >= LCD->Height )
+   {
+      return HAL_ERROR;
+   }
+
+   scroll_height = LCD->Height - top_fixed - bottom_fixed;
+
+// 控制器按显存的物理行定义滚动区域，上下翻转时屏幕的底部是显存的第0行，
+// 显存中不显示的行（LCD_MemoryHeight - LCD->Height）也要算在固定区域里
+	LCD_WriteCommand(0x33);       // 垂直滚动区域定义 指令
+   if( LCD->Direction == Direction_V )
+   {
+      LCD_WriteData_16bit(top_fixed);
+      LCD_WriteData_16bit(scroll_height);
+      LCD_WriteData_16bit(LCD_MemoryHeight - LCD->Height + bottom_fixed);
+   }
+   else
+   {
+      LCD_WriteData_16bit(bottom_fixed);
+      LCD_WriteData_16bit(scroll_height);
+      LCD_WriteData_16bit(LCD_MemoryHeight - LCD->Height + top_fixed);
+   }
+
+   LCD->Scroll_Top    = top_fixed;
+   LCD->Scroll_Height = scroll_height;
+   LCD_SetScrollStart(0);
+
+   return HAL_OK;
+}
+
+/****************************************************************************************************************************************
+*	函 数 名:	LCD_SetScrollStart
+*
+*	入口参数:	line - 滚动区域第一行要显示的行，范围 0 ~ 滚动区域行数-1
+*
+*	函数功能:	设置硬件垂直滚动的起始行，只需要发送一个指令，不需要重新写入显存
+*
+*	说    明:	1. 需要先用 LCD_SetScrollArea() 设置滚动区域
+*					2. 滚动区域的第 i 行显示的是滚动前第 (i + line) % 滚动区域行数 行的内容，
+*					   例如内容向上滚动 n 行时，line 增加 n，滚动区域底部的 n 行需要重新写入
+*
+*****************************************************************************************************************************************/
+
+void LCD_SetScrollStart(uint16_t line)
+{
+   uint16_t bottom_fixed;
+
+   if( LCD->Scroll_Height == 0 )
+   {
+      return;
+   }
+
+   line = line % LCD->Scroll_Height;
+   LCD->Scroll_Start = line;
+
+	LCD_WriteCommand(0x37);       // 垂直滚动起始地址 指令，写入的是显存的物理行
+   if( LCD->Direction == Direction_V )
+   {
+      LCD_WriteData_16bit(LCD->Scroll_Top + line);
+   }
+   else   // 上下翻转时显存的物理行和屏幕的行方向相反
+   {
+      bottom_fixed = LCD->Height - LCD->Scroll_Top - LCD->Scroll_Height;
+      LCD_WriteData_16bit(bottom_fixed + (LCD->Scroll_Height - line) % LCD->Scroll_Height);
+   }
+}
+
+/****************************************************************************************************************************************
+*	函 数 名:	LCD_GetScrollStart
+*
+*	返 回 值:	当前的滚动起始行，没有设置滚动区域时为0
+*
+*****************************************************************************************************************************************/
+
+uint16_t LCD_GetScrollStart(void)
+{
+   return LCD->Scroll_Start;
+}
+
+/****************************************************************************************************************************************
+*	函 数 名:	LCD_ScrollOff
+*
+*	函数功能:	退出硬件垂直滚动，屏幕的行和显存的行重新一一对应
+*
+*	说    明:	退出之后显示的内容和显存一致，滚动过的区域需要重新写入
+*
+*****************************************************************************************************************************************/
+
+void LCD_ScrollOff(void)
+{
+	LCD_WriteCommand(0x33);       // 垂直滚动区域定义 指令，整个显存都是滚动区域
+   LCD_WriteData_16bit(0);
+   LCD_WriteData_16bit(LCD_MemoryHeight);
+   LCD_WriteData_16bit(0);
+
+	LCD_WriteCommand(0x37);       // 滚动起始地址为0，即不滚动
+   LCD_WriteData_16bit(0);
+
+	LCD_WriteCommand(0x13);       // 普通显示模式 指令，退出滚动模式
+
+   LCD->Scroll_Top    = 0;
+   LCD->Scroll_Height = 0;
+   LCD->Scroll_Start  = 0;
+}
+
+
+/****************************************************************************************************************************************
+*	函 数 名:	LCD_TE_On
+*
+*	函数功能:	打开控制器的TE（撕裂效应）信号输出，并配置TE引脚的外部中断
+*
+*	说    明:	1. 控制器每次刷新完一帧，开始垂直消隐时TE引脚输出一个高电平脉冲
+*					2. 需要在TE引脚的外部中断里调用 LCD_TE_Callback() 记录信号的时间，
+*					   用 DWT 计时，测量出刷新周期之后就可以估计控制器当前扫描到的行
+*					3. 屏幕句柄的 TE_Port 为 NULL 时，说明没有连接TE引脚，不做任何操作
+*
+*****************************************************************************************************************************************/
+
+void LCD_TE_On(void)
+{
+   GPIO_InitTypeDef GPIO_InitStruct = {0};
+
+   if( LCD->TE_Port == NULL )
+   {
+      return;
+   }
+
+// 打开 DWT 的时钟周期计数器，用于给TE信号计时
+   CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+   DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+   GPIO_LDC_TE_CLK_ENABLE;    // 默认屏幕TE引脚的时钟，其它端口的时钟由 MX_GPIO_Init() 打开
+
+   GPIO_InitStruct.Pin 		= LCD->TE_Pin;				// TE 引脚
+   GPIO_InitStruct.Mode 	= GPIO_MODE_IT_RISING;	// 上升沿触发中断
+   GPIO_InitStruct.Pull 	= GPIO_PULLDOWN;
+   HAL_GPIO_Init(LCD->TE_Port, &GPIO_InitStruct);
+
+   LCD->TE.Count  = 0;
+   LCD->TE.Period = 0;
+
+   HAL_NVIC_SetPriority(LCD->TE_IRQn, 0, 0);
+   HAL_NVIC_EnableIRQ(LCD->TE_IRQn);
+
+	LCD_WriteCommand(0x35);       // 打开TE输出 指令
+	LCD_WriteData_8bit(0x00);     // 只在垂直消隐时输出
+}
+
+/****************************************************************************************************************************************
+*	函 数 名:	LCD_TE_Off
+*
+*	函数功能:	关闭TE信号输出，LCD_CopyBuffer() 不再等待扫描线
+*
+*****************************************************************************************************************************************/
+
+void LCD_TE_Off(void)
+{
+   if( LCD->TE_Port == NULL )
+   {
+      return;
+   }
+   HAL_NVIC_DisableIRQ(LCD->TE_IRQn);     // 多个屏幕共用一个中断线时，需要自行处理
+
+	LCD_WriteCommand(0x34);       // 关闭TE输出 指令
+
+   LCD->TE.Count  = 0;
+   LCD->TE.Period = 0;
+}
+
+/****************************************************************************************************************************************
+*	函 数 名:	LCD_TE_Callback
+*
+*	入口参数:	hlcd - 产生TE信号的屏幕
+*
+*	函数功能:	记录TE信号的时间，并更新刷新周期
+*
+*	说    明:	在TE引脚的外部中断里调用，例如 HAL_GPIO_EXTI_Callback() 中判断是 hlcd1.TE_Pin 时调用 LCD_TE_Callback(&hlcd1)
+*
+*****************************************************************************************************************************************/
+
+void LCD_TE_Callback(LCD_HandleTypeDef *hlcd)
+{
+   uint32_t now = DWT->CYCCNT;
+   uint32_t period;
+
+   if( hlcd->TE.Count > 0 )
+   {
+      period = now - hlcd->TE.Last_Time;
+
+      if( hlcd->TE.Period == 0 )
+      {
+         hlcd->TE.Period = period;
+      }
+      else if( period > hlcd->TE.Period / 2 && period < hlcd->TE.Period + hlcd->TE.Period / 2 )   // 漏掉的TE信号不参与计算
+      {
+         hlcd->TE.Period = (hlcd->TE.Period * 7 + period) / 8;
+      }
+   }
+
+   hlcd->TE.Last_Time = now;
+   hlcd->TE.Count++;
+}
+
+/****************************************************************************************************************************************
+*	函 数 名:	LCD_TE_IsActive
+*
+*	返 回 值:	1 - 已经测量出刷新周期，并且最近收到了TE信号，0 - 无法和控制器的扫描同步
+*
+*****************************************************************************************************************************************/
+
+static uint8_t LCD_TE_IsActive(uint32_t now)
+{
+   if( LCD->TE.Period == 0 )
+   {
+      return 0;
+   }
+   return (now - LCD->TE.Last_Time) < LCD->TE.Period * 2;
+}
+
+/****************************************************************************************************************************************
+*	函 数 名:	LCD_TE_GetScanLine
+*
+*	返 回 值:	估计控制器当前扫描到的行，范围 0 ~ LCD_MemoryHeight-1，没有TE信号时返回 0xFFFF
+*
+*	说    明:	1. 扫描的是显存的物理行，控制器按 LCD_MemoryHeight 行扫描，从TE信号开始计算，忽略消隐时间
+*					2. 硬件滚动和显示方向不影响扫描的顺序，只影响显存的行在哪一行显示
+*
+*****************************************************************************************************************************************/
+
+uint16_t LCD_TE_GetScanLine(void)
+{
+   uint32_t now = DWT->CYCCNT;
+
+   if( !LCD_TE_IsActive(now) )
+   {
+      return 0xFFFF;
+   }
+   return (uint16_t)((uint64_t)((now - LCD->TE.Last_Time) % LCD->TE.Period) * LCD_MemoryHeight / LCD->TE.Period);
+}
+
+/****************************************************************************************************************************************
+*	函 数 名:	LCD_TE_SetMode
+*
+*	入口参数:	mode - 同步方式，可选 LCD_TE_Mode_Off、LCD_TE_Mode_Vsync、LCD_TE_Mode_Beam
+*
+*	函数功能:	设置 LCD_CopyBuffer() 写入的时机和控制器扫描的同步方式
+*
+*	说    明:	1. 需要先用 LCD_TE_On() 打开TE信号，没有TE信号时不等待
+*					2. 每帧写入之前需要调用 LCD_TE_FrameStart()，用于区分每一帧
+*					3. LCD_TE_Mode_Vsync ：每帧等到TE信号之后再开始写入，写入的速度比扫描快时整帧不会撕裂，但是帧率会是刷新率的整数分之一
+*					4. LCD_TE_Mode_Beam  ：根据上一帧写入花费的时间，选择这一帧开始写入的时机，使写入的位置和扫描线不会交叉，
+*					   写入比扫描慢也可以，等待的时间比 LCD_TE_Mode_Vsync 少；每个区域写入之前，也会等扫描线离开这个区域
+*					5. 横屏显示时屏幕的一行对应所有扫描行，整行宽的区域无法避开扫描线，需要使用 LCD_TE_Mode_Vsync
+*
+*****************************************************************************************************************************************/
+
+void LCD_TE_SetMode(uint8_t mode)
+{
+   LCD->TE.Mode        = mode;
+   LCD->TE.Frame_First = 0;
+   LCD->TE.Frame_Valid = 0;
+}
+
+/****************************************************************************************************************************************
+*	函 数 名:	LCD_TE_FrameStart
+*
+*	函数功能:	在一帧的第一个区域写入之前调用，统计帧间隔，LCD_TE_Mode_Vsync 时等待下一个TE信号
+*
+*****************************************************************************************************************************************/
+
+void LCD_TE_FrameStart(void)
+{
+   uint32_t now = DWT->CYCCNT;
+   uint32_t frame_time;
+   uint32_t count;
+
+   if( LCD->TE.Frame_Count > 0 )
+   {
+      frame_time = now - LCD->TE.Frame_Start;
+      LCD->TE.Frame_Time_Sum += frame_time;
+      if( frame_time > LCD->TE.Frame_Time_Max )  LCD->TE.Frame_Time_Max = frame_time;
+   }
+   LCD->TE.Frame_Start = now;
+   LCD->TE.Frame_Count++;
+
+// 上一帧已经写完，记录写入位置移动的行数和花费的时间，用于估计这一帧
+   if( LCD->TE.Mode == LCD_TE_Mode_Beam )
+   {
+      if( LCD->TE.Frame_First == 0 && LCD->TE.Frame_Write_End != LCD->TE.Frame_Write_Start )
+      {
+         LCD->TE.Frame_Lines    = LCD->TE.Frame_Last_Line - LCD->TE.Frame_First_Line;
+         LCD->TE.Frame_Duration = LCD->TE.Frame_Write_End - LCD->TE.Frame_Write_Start;
+         LCD->TE.Frame_Valid    = 1;
+      }
+      LCD->TE.Frame_First = 1;
+   }
+
+   if( LCD->TE.Mode == LCD_TE_Mode_Vsync && LCD_TE_IsActive(now) )
+   {
+      count = LCD->TE.Count;
+      while( LCD->TE.Count == count && (DWT->CYCCNT - now) < LCD->TE.Period * 2 );    // 等待下一个TE信号，超时说明TE信号停止了
+
+      LCD->TE.Wait_Time += DWT->CYCCNT - now;
    }
 }
 
+/****************************************************************************************************************************************
+*	函 数 名:	LCD_TE_GetStats
+*
+*	入口参数:	stats - 用于保存统计结果，时间单位都是us
+*
+*	函数功能:	获取TE信号和帧间隔的统计结果，用于观察帧率是否稳定、等待扫描线花费了多少时间
+*
+*****************************************************************************************************************************************/
+
+void LCD_TE_GetStats(LCD_TE_StatsTypeDef *stats)
+{
+   uint32_t cycles_per_us = SystemCoreClock / 1000000;
+
+   stats->TE_Count       = LCD->TE.Count;
+   stats->Period         = LCD->TE.Period / cycles_per_us;
+   stats->Frame_Count    = LCD->TE.Frame_Count;
+   stats->Frame_Time     = LCD->TE.Frame_Count > 1 ? (uint32_t)(LCD->TE.Frame_Time_Sum / (LCD->TE.Frame_Count - 1) / cycles_per_us) : 0;
+   stats->Frame_Time_Max = LCD->TE.Frame_Time_Max / cycles_per_us;
+   stats->Wait_Time      = (uint32_t)(LCD->TE.Wait_Time / cycles_per_us);
+   stats->Unsafe_Count   = LCD->TE.Unsafe_Count;
+}
+
+/****************************************************************************************************************************************
+*	函 数 名:	LCD_TE_ResetStats
+*
+*	函数功能:	清除帧间隔和等待时间的统计，刷新周期继续使用之前测量的结果
+*
+*****************************************************************************************************************************************/
+
+void LCD_TE_ResetStats(void)
+{
+   LCD->TE.Frame_Count    = 0;
+   LCD->TE.Frame_Time_Sum = 0;
+   LCD->TE.Frame_Time_Max = 0;
+   LCD->TE.Wait_Time      = 0;
+   LCD->TE.Unsafe_Count   = 0;
+}
+
+/****************************************************************************************************************************************
+*	函 数 名:	LCD_TE_Wait
+*
+*	入口参数:	start - 开始等待的时间，wait - 等待的时间
+*
+*****************************************************************************************************************************************/
+
+static void LCD_TE_Wait(uint32_t start, uint32_t wait)
+{
+   while( (DWT->CYCCNT - start) < wait );
+
+   LCD->TE.Wait_Time += wait;
+}
+
+/****************************************************************************************************************************************
+*	函 数 名:	LCD_TE_WaitArea
+*
+*	入口参数:	x、y、width、height - 要写入的屏幕区域，bytes - 需要传输的字节数
+*
+*	函数功能:	LCD_TE_Mode_Beam 时，等到可以写入这个区域的时机
+*
+*	说    明:	1. 坐标是屏幕的坐标，显示在哪一个扫描行只和显示方向有关，硬件滚动只改变显存的行显示在哪一行
+*					2. 竖屏时屏幕的行就是扫描行，横屏时（MV=1）屏幕的列是扫描行，上下翻转时（MY=1）扫描行是反的
+*					3. 一帧的第一个区域：扫描线领先写入位置的行数为 d，这一帧写入期间扫描线移动 L 行、写入位置移动 n 行，
+*					   d 会变为 d + L - n，d 在 0 ~ LCD_MemoryHeight 之间时扫描线和写入位置不会交叉，不在这个范围就等待扫描线移动
+*					4. 每个区域：传输期间扫描线经过这个区域时，等扫描线离开之后再写入
+*
+*****************************************************************************************************************************************/
+
+static void LCD_TE_WaitArea(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint32_t bytes)
+{
+   uint32_t now = DWT->CYCCNT;
+   int32_t  first, lines;     // 区域对应的第一个扫描行和行数
+   int32_t  start_line;       // 按写入顺序，区域开始写入的扫描行
+   int32_t  scan_line;        // 当前扫描到的行
+   int32_t  move;             // 这一帧写入期间，扫描线相对写入位置移动的行数
+   int32_t  lead, lead_min, lead_max;    // 扫描线领先写入位置的行数，以及允许的范围
+   int32_t  margin;           // 扫描线和写入位置之间至少间隔的行数
+   uint32_t phase;            // 当前在一次刷新中的时间
+   uint32_t area_start;       // 扫描线到达区域的时间
+   uint32_t area_time;        // 扫描线经过区域的时间
+   uint32_t transfer;         // 传输时间
+
+   if( !LCD_TE_IsActive(now) )
+   {
+      return;
+   }
+
+   if( LCD->Direction == Direction_H || LCD->Direction == Direction_H_Flip )
+   {
+      first = x + LCD->X_Offset;
+      lines = width;
+   }
+   else
+   {
+      first = y + LCD->Y_Offset;
+      lines = height;
+   }
+   start_line = first;
+   if( LCD->Direction == Direction_H_Flip || LCD->Direction == Direction_V_Flip )
+   {
+      first      = LCD_MemoryHeight - first - lines;
+      start_line = first + lines - 1;
+   }
+
+   transfer = (uint64_t)LCD->TE.Byte_Time * bytes / 256;
+
+// 一帧的第一个区域，选择开始写入的时机，扫描线和写入位置之间留出一个区域和一次传输的距离
+   if( LCD->TE.Frame_First && LCD->TE.Frame_Valid )
+   {
+      margin   = LCD_TE_GUARD_LINES + lines + (int32_t)((uint64_t)transfer * LCD_MemoryHeight / LCD->TE.Period);
+      move     = (int32_t)((uint64_t)LCD->TE.Frame_Duration * LCD_MemoryHeight / LCD->TE.Period) - LCD->TE.Frame_Lines;
+      lead_min = margin + (move < 0 ? -move : 0);
+      lead_max = LCD_MemoryHeight - margin - (move > 0 ? move : 0);
+
+      if( lead_min > lead_max )     // 写入太慢，扫描线一定会和写入位置交叉
+      {
+         LCD->TE.Unsafe_Count++;
+      }
+      else
+      {
+         phase     = (now - LCD->TE.Last_Time) % LCD->TE.Period;
+         scan_line = (int32_t)((uint64_t)phase * LCD_MemoryHeight / LCD->TE.Period);
+         lead      = (scan_line - start_line + LCD_MemoryHeight) % LCD_MemoryHeight;
+         if( lead < lead_min || lead > lead_max )
+         {
+            LCD_TE_Wait(now, (uint64_t)LCD->TE.Period * ((lead_min - lead + LCD_MemoryHeight) % LCD_MemoryHeight) / LCD_MemoryHeight);
+            now = DWT->CYCCNT;
+         }
+      }
+   }
+
+// 区域前后各多留出几行，抵消刷新周期和消隐时间的误差
+   area_start = (uint64_t)LCD->TE.Period * ((first - LCD_TE_GUARD_LINES + LCD_MemoryHeight) % LCD_MemoryHeight) / LCD_MemoryHeight;
+   area_time  = (uint64_t)LCD->TE.Period * (lines + LCD_TE_GUARD_LINES * 2) / LCD_MemoryHeight;
+
+   if( area_time + transfer >= LCD->TE.Period )   // 区域太大或者传输太慢，扫描线一定会经过
+   {
+      LCD->TE.Unsafe_Count++;
+   }
+   else
+   {
+   // 传输期间扫描线所在的时间段 [phase, phase + transfer] 和区域的时间段 [area_start, area_start + area_time] 不能重叠
+      phase = (now - LCD->TE.Last_Time) % LCD->TE.Period;
+      if( (phase + LCD->TE.Period - area_start) % LCD->TE.Period < area_time ||
+          (area_start + LCD->TE.Period - phase) % LCD->TE.Period < transfer )
+      {
+         LCD_TE_Wait(now, (area_start + area_time + LCD->TE.Period - phase) % LCD->TE.Period);    // 等到扫描线离开区域
+      }
+   }
+
+   if( LCD->TE.Frame_First )
+   {
+      LCD->TE.Frame_First       = 0;
+      LCD->TE.Frame_First_Line  = start_line;
+      LCD->TE.Frame_Write_Start = DWT->CYCCNT;
+   }
+   LCD->TE.Frame_Last_Line = start_line == first ? first + lines - 1 : first;
+}
 
 /****************************************************************************************************************************************
 *	函 数 名:	LCD_SetAsciiFont
@@ -385,14 +994,14 @@ void LCD_SetDirection(uint8_t direction)
 
 void LCD_SetAsciiFont(pFONT *Asciifonts)
 {
-  LCD_AsciiFonts = Asciifonts;
+  LCD->AsciiFonts = Asciifonts;
 }
 
 
 /****************************************************************************************************************************************
 *	函 数 名:	LCD_Clear
 *
-*	函数功能:	清屏函数，将LCD清除为 LCD.BackColor 的颜色
+*	函数功能:	清屏函数，将LCD清除为 LCD->BackColor 的颜色
 *
 *	说    明:	先用 LCD_SetBackColor() 设置要清除的背景色，再调用该函数清屏即可
 *
@@ -400,7 +1009,7 @@ void LCD_SetAsciiFont(pFONT *Asciifonts)
 
 void LCD_Clear(void)
 {
-   LCD_SetAddress(0,0,LCD.Width-1,LCD.Height-1);	// 设置坐标
+   LCD_SetAddress(0,0,LCD->Width-1,LCD->Height-1);	// 设置坐标
 
 	LCD_DC_Data;     // 数据指令选择 引脚输出高电平，代表本次传输 数据
 
@@ -408,7 +1017,7 @@ void LCD_Clear(void)
    LCD_SPI.Init.DataSize 	= SPI_DATASIZE_16BIT;   //	16位数据宽度
    HAL_SPI_Init(&LCD_SPI);
 
-   LCD_SPI_Transmit(&LCD_SPI, LCD.BackColor, LCD.Width * LCD.Height) ;   // 启动传输
+   LCD_SPI_Transmit(&LCD_SPI, LCD->BackColor, LCD->Width * LCD->Height) ;   // 启动传输
 
 // 改回8位数据宽度，因为指令和部分数据都是按照8位传输的
 	LCD_SPI.Init.DataSize 	= SPI_DATASIZE_8BIT;    //	8位数据宽度
@@ -423,7 +1032,7 @@ void LCD_Clear(void)
 *					width  - 要清除区域的横向长度
 *					height - 要清除区域的纵向宽度
 *
-*	函数功能:	局部清屏函数，将指定位置对应的区域清除为 LCD.BackColor 的颜色
+*	函数功能:	局部清屏函数，将指定位置对应的区域清除为 LCD->BackColor 的颜色
 *
 *	说    明:	1. 先用 LCD_SetBackColor() 设置要清除的背景色，再调用该函数清屏即可
 *				   2. 使用示例 LCD_ClearRect( 10, 10, 100, 50) ，清除坐标(10,10)开始的长100宽50的区域
@@ -440,7 +1049,7 @@ void LCD_ClearRect(uint16_t x, uint16_t y, uint16_t width, uint16_t height)
    LCD_SPI.Init.DataSize 	= SPI_DATASIZE_16BIT;   //	16位数据宽度
    HAL_SPI_Init(&LCD_SPI);
 
-   LCD_SPI_Transmit(&LCD_SPI, LCD.BackColor, width*height) ;  // 启动传输
+   LCD_SPI_Transmit(&LCD_SPI, LCD->BackColor, width*height) ;  // 启动传输
 
 // 改回8位数据宽度，因为指令和部分数据都是按照8位传输的
 	LCD_SPI.Init.DataSize 	= SPI_DATASIZE_8BIT;    //	8位数据宽度
@@ -493,31 +1102,31 @@ void LCD_DisplayChar(uint16_t x, uint16_t y,uint8_t c)
 
 	c = c - 32; 	// 计算ASCII字符的偏移
 
-	for(index = 0; index < LCD_AsciiFonts->Sizes; index++)
+	for(index = 0; index < LCD->AsciiFonts->Sizes; index++)
 	{
-		disChar = LCD_AsciiFonts->pTable[c*LCD_AsciiFonts->Sizes + index]; //获取字符的模值
+		disChar = LCD->AsciiFonts->pTable[c*LCD->AsciiFonts->Sizes + index]; //获取字符的模值
 		for(counter = 0; counter < 8; counter++)
 		{
 			if(disChar & 0x01)
 			{
-            LCD_Buff[i] =  LCD.Color;			// 当前模值不为0时，使用画笔色绘点
+            LCD_Buff[i] =  LCD->Color;			// 当前模值不为0时，使用画笔色绘点
 			}
 			else
 			{
-            LCD_Buff[i] = LCD.BackColor;		//否则使用背景色绘制点
+            LCD_Buff[i] = LCD->BackColor;		//否则使用背景色绘制点
 			}
 			disChar >>= 1;
 			i++;
          w++;
- 			if( w == LCD_AsciiFonts->Width ) // 如果写入的数据达到了字符宽度，则退出当前循环
+ 			if( w == LCD->AsciiFonts->Width ) // 如果写入的数据达到了字符宽度，则退出当前循环
 			{								   // 进入下一字符的写入的绘制
 				w = 0;
 				break;
 			}
 		}
 	}
-   LCD_SetAddress( x, y, x+LCD_AsciiFonts->Width-1, y+LCD_AsciiFonts->Height-1);	   // 设置坐标
-   LCD_WriteBuff(LCD_Buff,LCD_AsciiFonts->Width*LCD_AsciiFonts->Height);          // 写入显存
+   LCD_SetAddress( x, y, x+LCD->AsciiFonts->Width-1, y+LCD->AsciiFonts->Height-1);	   // 设置坐标
+   LCD_WriteBuff(LCD_Buff,LCD->AsciiFonts->Width*LCD->AsciiFonts->Height);          // 写入显存
 }
 
 /****************************************************************************************************************************************
@@ -538,10 +1147,10 @@ void LCD_DisplayChar(uint16_t x, uint16_t y,uint8_t c)
 
 void LCD_DisplayString( uint16_t x, uint16_t y, char *p)
 {
-	while ((x < LCD.Width) && (*p != 0))	//判断显示坐标是否超出显示区域并且字符是否为空字符
+	while ((x < LCD->Width) && (*p != 0))	//判断显示坐标是否超出显示区域并且字符是否为空字符
 	{
 		 LCD_DisplayChar( x,y,*p);
-		 x += LCD_AsciiFonts->Width; //显示下一个字符
+		 x += LCD->AsciiFonts->Width; //显示下一个字符
 		 p++;	//取下一个字符地址
 	}
 }
@@ -564,14 +1173,14 @@ void LCD_DisplayString( uint16_t x, uint16_t y, char *p)
 
 void LCD_SetTextFont(pFONT *fonts)
 {
-	LCD_CHFonts = fonts;		// 设置中文字体
+	LCD->CHFonts = fonts;		// 设置中文字体
 	switch(fonts->Width )
 	{
-		case 12:	LCD_AsciiFonts = &ASCII_Font12;	break;	// 设置ASCII字符的字体为 1206
-		case 16:	LCD_AsciiFonts = &ASCII_Font16;	break;	// 设置ASCII字符的字体为 1608
-		case 20:	LCD_AsciiFonts = &ASCII_Font20;	break;	// 设置ASCII字符的字体为 2010
-		case 24:	LCD_AsciiFonts = &ASCII_Font24;	break;	// 设置ASCII字符的字体为 2412
-		case 32:	LCD_AsciiFonts = &ASCII_Font32;	break;	// 设置ASCII字符的字体为 3216
+		case 12:	LCD->AsciiFonts = &ASCII_Font12;	break;	// 设置ASCII字符的字体为 1206
+		case 16:	LCD->AsciiFonts = &ASCII_Font16;	break;	// 设置ASCII字符的字体为 1608
+		case 20:	LCD->AsciiFonts = &ASCII_Font20;	break;	// 设置ASCII字符的字体为 2010
+		case 24:	LCD->AsciiFonts = &ASCII_Font24;	break;	// 设置ASCII字符的字体为 2412
+		case 32:	LCD->AsciiFonts = &ASCII_Font32;	break;	// 设置ASCII字符的字体为 3216
 		default: break;
 	}
 }
@@ -601,43 +1210,43 @@ void LCD_DisplayChinese(uint16_t x, uint16_t y, char *pText)
 	while(1)
 	{
 		// 对比数组中的汉字编码，用以定位该汉字字模的地址
-		if ( *(LCD_CHFonts->pTable + (i+1)*LCD_CHFonts->Sizes + 0)==*pText && *(LCD_CHFonts->pTable + (i+1)*LCD_CHFonts->Sizes + 1)==*(pText+1) )
+		if ( *(LCD->CHFonts->pTable + (i+1)*LCD->CHFonts->Sizes + 0)==*pText && *(LCD->CHFonts->pTable + (i+1)*LCD->CHFonts->Sizes + 1)==*(pText+1) )
 		{
 			addr=i;	// 字模地址偏移
 			break;
 		}
 		i+=2;	// 每个中文字符编码占两字节
 
-		if(i >= LCD_CHFonts->Table_Rows)	break;	// 字模列表中无相应的汉字
+		if(i >= LCD->CHFonts->Table_Rows)	break;	// 字模列表中无相应的汉字
 	}
 	i=0;
-	for(index = 0; index <LCD_CHFonts->Sizes; index++)
+	for(index = 0; index <LCD->CHFonts->Sizes; index++)
 	{
-		disChar = *(LCD_CHFonts->pTable + (addr)*LCD_CHFonts->Sizes + index);	// 获取相应的字模地址
+		disChar = *(LCD->CHFonts->pTable + (addr)*LCD->CHFonts->Sizes + index);	// 获取相应的字模地址
 
 		for(counter = 0; counter < 8; counter++)
 		{
 			if(disChar & 0x01)
 			{
-            LCD_Buff[i] =  LCD.Color;			// 当前模值不为0时，使用画笔色绘点
+            LCD_Buff[i] =  LCD->Color;			// 当前模值不为0时，使用画笔色绘点
 			}
 			else
 			{
-            LCD_Buff[i] = LCD.BackColor;		// 否则使用背景色绘制点
+            LCD_Buff[i] = LCD->BackColor;		// 否则使用背景色绘制点
 			}
          i++;
 			disChar >>= 1;
 			Xaddress++;  //水平坐标自加
 
-			if( Xaddress == LCD_CHFonts->Width ) 	//	如果水平坐标达到了字符宽度，则退出当前循环
+			if( Xaddress == LCD->CHFonts->Width ) 	//	如果水平坐标达到了字符宽度，则退出当前循环
 			{														//	进入下一行的绘制
 				Xaddress = 0;
 				break;
 			}
 		}
 	}
-   LCD_SetAddress( x, y, x+LCD_CHFonts->Width-1, y+LCD_CHFonts->Height-1);	   // 设置坐标
-   LCD_WriteBuff(LCD_Buff,LCD_CHFonts->Width*LCD_CHFonts->Height);            // 写入显存
+   LCD_SetAddress( x, y, x+LCD->CHFonts->Width-1, y+LCD->CHFonts->Height-1);	   // 设置坐标
+   LCD_WriteBuff(LCD_Buff,LCD->CHFonts->Width*LCD->CHFonts->Height);            // 写入显存
 }
 
 /*****************************************************************************************************************************************
@@ -664,13 +1273,13 @@ void LCD_DisplayText(uint16_t x, uint16_t y, char *pText)
 		if(*pText<=0x7F)	// 判断是否为ASCII码
 		{
 			LCD_DisplayChar(x,y,*pText);	// 显示ASCII
-			x+=LCD_AsciiFonts->Width;				// 水平坐标调到下一个字符处
+			x+=LCD->AsciiFonts->Width;				// 水平坐标调到下一个字符处
 			pText++;								// 字符串地址+1
 		}
 		else					// 若字符为汉字
 		{
 			LCD_DisplayChinese(x,y,pText);	// 显示汉字
-			x+=LCD_CHFonts->Width;				// 水平坐标调到下一个字符处
+			x+=LCD->CHFonts->Width;				// 水平坐标调到下一个字符处
 			pText+=2;								// 字符串地址+2，汉字的编码要2字节
 		}
 	}
@@ -690,7 +1299,7 @@ void LCD_DisplayText(uint16_t x, uint16_t y, char *pText)
 
 void LCD_ShowNumMode(uint8_t mode)
 {
-	LCD.ShowNum_Mode = mode;
+	LCD->ShowNum_Mode = mode;
 }
 
 /*****************************************************************************************************************************************
@@ -715,7 +1324,7 @@ void  LCD_DisplayNumber( uint16_t x, uint16_t y, int32_t number, uint8_t len)
 {
 	char   Number_Buffer[15];				// 用于存储转换后的字符串
 
-	if( LCD.ShowNum_Mode == Fill_Zero)	// 多余位补0
+	if( LCD->ShowNum_Mode == Fill_Zero)	// 多余位补0
 	{
 		sprintf( Number_Buffer , "%0.*d",len, number );	// 将 number 转换成字符串，便于显示
 	}
@@ -756,7 +1365,7 @@ void  LCD_DisplayDecimals( uint16_t x, uint16_t y, double decimals, uint8_t len,
 {
 	char  Number_Buffer[20];				// 用于存储转换后的字符串
 
-	if( LCD.ShowNum_Mode == Fill_Zero)	// 多余位填充0模式
+	if( LCD->ShowNum_Mode == Fill_Zero)	// 多余位填充0模式
 	{
 		sprintf( Number_Buffer , "%0*.*lf",len,decs, decimals );	// 将 number 转换成字符串，便于显示
 	}
@@ -839,7 +1448,7 @@ void LCD_DrawLine(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
 	}
 	for (curpixel = 0; curpixel <= numpixels; curpixel++)
 	{
-	 LCD_DrawPoint(x,y,LCD.Color);             /* Draw the current pixel */
+	 LCD_DrawPoint(x,y,LCD->Color);             /* Draw the current pixel */
 	 num += numadd;              /* Increase the numerator by the top of the fraction */
 	 if (num >= den)             /* Check if numerator >= denominator */
 	 {
@@ -873,7 +1482,7 @@ void LCD_DrawLine_V(uint16_t x, uint16_t y, uint16_t height)
 
 	for (i = 0; i < height; i++)
 	{
-       LCD_Buff[i] =  LCD.Color;  // 写入缓冲区
+       LCD_Buff[i] =  LCD->Color;  // 写入缓冲区
    }
    LCD_SetAddress( x, y, x, y+height-1);	     // 设置坐标
 
@@ -901,7 +1510,7 @@ void LCD_DrawLine_H(uint16_t x, uint16_t y, uint16_t width)
 
 	for (i = 0; i < width; i++)
 	{
-       LCD_Buff[i] =  LCD.Color;  // 写入缓冲区
+       LCD_Buff[i] =  LCD->Color;  // 写入缓冲区
    }
    LCD_SetAddress( x, y, x+width-1, y);	     // 设置坐标
 
@@ -953,10 +1562,10 @@ void LCD_DrawCircle(uint16_t x, uint16_t y, uint16_t r)
 	int Xadd = -r, Yadd = 0, err = 2-2*r, e2;
 	do {
 
-		LCD_DrawPoint(x-Xadd,y+Yadd,LCD.Color);
-		LCD_DrawPoint(x+Xadd,y+Yadd,LCD.Color);
-		LCD_DrawPoint(x+Xadd,y-Yadd,LCD.Color);
-		LCD_DrawPoint(x-Xadd,y-Yadd,LCD.Color);
+		LCD_DrawPoint(x-Xadd,y+Yadd,LCD->Color);
+		LCD_DrawPoint(x+Xadd,y+Yadd,LCD->Color);
+		LCD_DrawPoint(x+Xadd,y-Yadd,LCD->Color);
+		LCD_DrawPoint(x-Xadd,y-Yadd,LCD->Color);
 
 		e2 = err;
 		if (e2 <= Yadd) {
@@ -997,10 +1606,10 @@ void LCD_DrawEllipse(int x, int y, int r1, int r2)
     do {
       K = (float)(rad1/rad2);
 
-		LCD_DrawPoint(x-Xadd,y+(uint16_t)(Yadd/K),LCD.Color);
-		LCD_DrawPoint(x+Xadd,y+(uint16_t)(Yadd/K),LCD.Color);
-		LCD_DrawPoint(x+Xadd,y-(uint16_t)(Yadd/K),LCD.Color);
-		LCD_DrawPoint(x-Xadd,y-(uint16_t)(Yadd/K),LCD.Color);
+		LCD_DrawPoint(x-Xadd,y+(uint16_t)(Yadd/K),LCD->Color);
+		LCD_DrawPoint(x+Xadd,y+(uint16_t)(Yadd/K),LCD->Color);
+		LCD_DrawPoint(x+Xadd,y-(uint16_t)(Yadd/K),LCD->Color);
+		LCD_DrawPoint(x-Xadd,y-(uint16_t)(Yadd/K),LCD->Color);
 
       e2 = err;
       if (e2 <= Yadd) {
@@ -1018,10 +1627,10 @@ void LCD_DrawEllipse(int x, int y, int r1, int r2)
     do {
       K = (float)(rad2/rad1);
 
-		LCD_DrawPoint(x-(uint16_t)(Xadd/K),y+Yadd,LCD.Color);
-		LCD_DrawPoint(x+(uint16_t)(Xadd/K),y+Yadd,LCD.Color);
-		LCD_DrawPoint(x+(uint16_t)(Xadd/K),y-Yadd,LCD.Color);
-		LCD_DrawPoint(x-(uint16_t)(Xadd/K),y-Yadd,LCD.Color);
+		LCD_DrawPoint(x-(uint16_t)(Xadd/K),y+Yadd,LCD->Color);
+		LCD_DrawPoint(x+(uint16_t)(Xadd/K),y+Yadd,LCD->Color);
+		LCD_DrawPoint(x+(uint16_t)(Xadd/K),y-Yadd,LCD->Color);
+		LCD_DrawPoint(x-(uint16_t)(Xadd/K),y-Yadd,LCD->Color);
 
       e2 = err;
       if (e2 <= Xadd) {
@@ -1113,7 +1722,7 @@ void LCD_FillRect(uint16_t x, uint16_t y, uint16_t width, uint16_t height)
    LCD_SPI.Init.DataSize 	= SPI_DATASIZE_16BIT;   //	16位数据宽度
    HAL_SPI_Init(&LCD_SPI);
 
-   LCD_SPI_Transmit(&LCD_SPI, LCD.Color, width*height) ;
+   LCD_SPI_Transmit(&LCD_SPI, LCD->Color, width*height) ;
 
 // 改回8位数据宽度，因为指令和部分数据都是按照8位传输的
 	LCD_SPI.Init.DataSize 	= SPI_DATASIZE_8BIT;    //	8位数据宽度
@@ -1159,11 +1768,11 @@ void 	LCD_DrawImage(uint16_t x,uint16_t y,uint16_t width,uint16_t height,const u
 			{
 				if(disChar & 0x01)
 				{
-               LCD_Buff[BuffCount] =  LCD.Color;			// 当前模值不为0时，使用画笔色绘点
+               LCD_Buff[BuffCount] =  LCD->Color;			// 当前模值不为0时，使用画笔色绘点
 				}
 				else
 				{
-				   LCD_Buff[BuffCount] = LCD.BackColor;		//否则使用背景色绘制点
+				   LCD_Buff[BuffCount] = LCD->BackColor;		//否则使用背景色绘制点
 				}
 				disChar >>= 1;     // 模值移位
 				Xaddress++;        // 水平坐标自加
@@ -1205,15 +1814,215 @@ void 	LCD_DrawImage(uint16_t x,uint16_t y,uint16_t width,uint16_t height,const u
 *
 *	函数功能: 在指定坐标处，直接将数据复制到屏幕的显存
 *
-*	说    明: 批量复制函数，可用于移植 LVGL 或者将摄像头采集的图像显示出来
+*	说    明: 1. 批量复制函数，可用于移植 LVGL 或者将摄像头采集的图像显示出来
+*				 2. 设置了硬件滚动区域时，坐标是滚动之后屏幕上的坐标
+*				 3. LCD_TE_SetMode(LCD_TE_Mode_Beam) 之后，写入之前会等到写入位置不和扫描线交叉的时机
 *
 *****************************************************************************************************************************************/
 
 void LCD_CopyBuffer(uint16_t x, uint16_t y,uint16_t width,uint16_t height,uint16_t *DataBuff)
 {
+   uint16_t rows;       // 本次写入的行数
+   uint16_t mem_y;      // 本次写入的起始行在显存中的位置
+   uint16_t scroll_y;   // 在滚动区域中的行
+   uint32_t bytes;      // 需要传输的字节数
+   uint32_t start;      // 开始传输的时间
+
+   if( width == 0 || height == 0 )   // 空区域不需要传输，也避免测量传输速度时除以0
+   {
+      return;
+   }
+
+   bytes = (uint32_t)width * height * 2;
+   if( LCD->Pixel_Format == LCD_Format_RGB444 )       bytes = bytes * 3 / 4;
+   else if( LCD->Pixel_Format == LCD_Format_RGB666 )  bytes = bytes * 3 / 2;
+
+   if( LCD->TE.Mode == LCD_TE_Mode_Beam )
+   {
+      LCD_TE_WaitArea(x, y, width, height, bytes);
+   }
+   start = DWT->CYCCNT;
+
+// 硬件滚动时，滚动区域里屏幕的行对应的显存行是循环移位的，需要分段写入
+   while( height > 0 )
+   {
+      rows  = height;
+      mem_y = y;
+
+      if( LCD->Scroll_Height != 0 )
+      {
+         if( y < LCD->Scroll_Top )      // 顶部固定区域
+         {
+            if( rows > LCD->Scroll_Top - y )  rows = LCD->Scroll_Top - y;
+         }
+         else if( y < LCD->Scroll_Top + LCD->Scroll_Height )     // 滚动区域，写到显存的末尾或者滚动区域的末尾为止
+         {
+            scroll_y = (y - LCD->Scroll_Top + LCD->Scroll_Start) % LCD->Scroll_Height;
+            mem_y    = LCD->Scroll_Top + scroll_y;
+            if( rows > LCD->Scroll_Height - scroll_y )  rows = LCD->Scroll_Height - scroll_y;
+            if( rows > LCD->Scroll_Top + LCD->Scroll_Height - y )  rows = LCD->Scroll_Top + LCD->Scroll_Height - y;
+         }
+      }
+
+      LCD_CopyRows(x, mem_y, width, rows, DataBuff);
+
+      DataBuff += width * rows;
+      y        += rows;
+      height   -= rows;
+   }
+// 测量传输速度，用于估计下次传输的时间
+   if( LCD->TE.Mode == LCD_TE_Mode_Beam )
+   {
+      LCD->TE.Frame_Write_End = DWT->CYCCNT;
+      LCD->TE.Byte_Time = (uint32_t)((uint64_t)(LCD->TE.Frame_Write_End - start) * 256 / bytes);
+   }
+}
+
+/***************************************************************************************************************************************
+*	函 数 名: LCD_CopyBuffer_DMA
+*
+*	入口参数: x - 起始水平坐标
+*				 y - 起始垂直坐标
+*			 	 width  - 目标区域的水平宽度
+*				 height - 目标区域的垂直宽度
+*				*DataBuff - 数据存储区的首地址，RGB565 格式
+*
+*	返 回 值: HAL_OK - 已经开始传输，或者已经直接写入完成
+*
+*	函数功能: 用 DMA 把数据复制到屏幕的显存，不等待传输完成，传输完成后调用屏幕的 TxCpltCallback
+*
+*	说    明: 1. 传输完成之前不能修改 DataBuff，驱动的其它函数操作这个屏幕时会先等待传输完成
+*				 2. SPI 没有配置 DMA、正在硬件滚动、像素格式不是 RGB565 或者数据太多时，调用 LCD_CopyBuffer() 直接写入，
+*				    返回之前就会调用 TxCpltCallback
+*				 3. SPI 和 DMA 的中断都要打开，并在 HAL_SPI_TxCpltCallback() 中调用 LCD_SPI_TxCpltCallback()
+*				 4. SPI6 只能使用 BDMA，DataBuff 需要放在 SRAM4；其它 SPI 使用 DMA1、DMA2，DataBuff 不能放在 DTCM
+*				 5. 多个屏幕接在不同的 SPI 上时，先后启动的传输会同时进行
+*
+*****************************************************************************************************************************************/
+
+HAL_StatusTypeDef LCD_CopyBuffer_DMA(uint16_t x, uint16_t y,uint16_t width,uint16_t height,uint16_t *DataBuff)
+{
+   uint32_t count = (uint32_t)width * height;   // 需要传输的像素数
+   HAL_StatusTypeDef status;
+
+   LCD_WaitIdle();
+
+   if( LCD->hspi->hdmatx == NULL || LCD->Scroll_Height != 0 || LCD->Pixel_Format != LCD_Format_RGB565 || count > 0xFFFF )
+   {
+      LCD_CopyBuffer(x, y, width, height, DataBuff);
+      if( LCD->TxCpltCallback != NULL )
+      {
+         LCD->TxCpltCallback(LCD);
+      }
+      return HAL_OK;
+   }
+
+   if( LCD->TE.Mode == LCD_TE_Mode_Beam )
+   {
+      LCD_TE_WaitArea(x, y, width, height, count * 2);
+   }
 
 	LCD_SetAddress(x,y,x+width-1,y+height-1);
 
+// DMA 直接读取内存，先把 D-Cache 中的数据写回内存
+   SCB_CleanDCache_by_Addr((uint32_t *)((uint32_t)DataBuff & ~31U), (int32_t)(count * 2 + ((uint32_t)DataBuff & 31U)));
+
+	LCD_DC_Data;     // 数据指令选择 引脚输出高电平，代表本次传输 数据
+
+// 修改为16位数据宽度，传输完成后在 LCD_SPI_TxCpltCallback() 里改回8位
+   LCD_SPI.Init.DataSize 	= SPI_DATASIZE_16BIT;   //	16位数据宽度
+   HAL_SPI_Init(&LCD_SPI);
+
+   LCD->DMA_Bytes = count * 2;
+   LCD->DMA_Start = DWT->CYCCNT;
+   LCD->Busy      = 1;
+
+   status = HAL_SPI_Transmit_DMA(&LCD_SPI, (uint8_t *)DataBuff, (uint16_t)count);
+   if( status != HAL_OK )
+   {
+      LCD->Busy = 0;
+      LCD_SPI.Init.DataSize 	= SPI_DATASIZE_8BIT;    //	8位数据宽度
+      HAL_SPI_Init(&LCD_SPI);
+   }
+   return status;
+}
+
+/***************************************************************************************************************************************
+*	函 数 名: LCD_SPI_TxCpltCallback
+*
+*	入口参数: hspi - 传输完成的SPI
+*
+*	函数功能: DMA传输完成后，恢复SPI的设置，并调用屏幕的 TxCpltCallback
+*
+*	说    明: 在 HAL_SPI_TxCpltCallback() 中调用，不是屏幕的SPI时不做任何操作
+*
+*****************************************************************************************************************************************/
+
+void LCD_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi)
+{
+   LCD_HandleTypeDef *hlcd = NULL;
+   uint8_t i;
+
+   for(i = 0; i < LCD_MAX_PANELS; i++)
+   {
+      if( LCD_Panels[i] != NULL && LCD_Panels[i]->hspi == hspi && LCD_Panels[i]->Busy )
+      {
+         hlcd = LCD_Panels[i];
+         break;
+      }
+   }
+   if( hlcd == NULL )
+   {
+      return;
+   }
+
+// 改回8位数据宽度，因为指令和部分数据都是按照8位传输的
+   hspi->Init.DataSize 	= SPI_DATASIZE_8BIT;    //	8位数据宽度
+   HAL_SPI_Init(hspi);
+
+// 测量传输速度，用于估计下次传输的时间
+   if( hlcd->TE.Mode == LCD_TE_Mode_Beam )
+   {
+      hlcd->TE.Frame_Write_End = DWT->CYCCNT;
+      hlcd->TE.Byte_Time = (uint32_t)((uint64_t)(hlcd->TE.Frame_Write_End - hlcd->DMA_Start) * 256 / hlcd->DMA_Bytes);
+   }
+
+   hlcd->Busy = 0;
+   if( hlcd->TxCpltCallback != NULL )
+   {
+      hlcd->TxCpltCallback(hlcd);
+   }
+}
+
+/***************************************************************************************************************************************
+*	函 数 名: LCD_WaitIdle
+*
+*	函数功能: 等待当前屏幕的DMA传输完成
+*
+*****************************************************************************************************************************************/
+
+void LCD_WaitIdle(void)
+{
+   while( LCD->Busy );
+}
+
+/***************************************************************************************************************************************
+*	函 数 名: LCD_CopyRows
+*
+*	函数功能: 将数据直接复制到显存的指定区域，不考虑硬件滚动
+*
+*****************************************************************************************************************************************/
+
+static void LCD_CopyRows(uint16_t x, uint16_t y,uint16_t width,uint16_t height,uint16_t *DataBuff)
+{
+	LCD_SetAddress(x,y,x+width-1,y+height-1);
+
+   if( LCD->Pixel_Format != LCD_Format_RGB565 )   // 其它格式需要先打包再发送
+   {
+      LCD_WritePacked(DataBuff, (uint32_t)width * height);
+      return;
+   }
+
 	LCD_DC_Data;     // 数据指令选择 引脚输出高电平，代表本次传输 数据
 
 // 修改为16位数据宽度，写入数据更加效率，不需要拆分
@@ -1231,8 +2040,140 @@ void LCD_CopyBuffer(uint16_t x, uint16_t y,uint16_t width,uint16_t height,uint16
 }
 
 
+/***************************************************************************************************************************************
+*	函 数 名: LCD_PackRGB444
+*
+*	入口参数: src - RGB565 数据，dst - 打包后的数据，count - 像素个数，按4个像素一组转换
+*
+*	函数功能: 每4个像素打包为3个16位数据，按 SPI 16位发送时的字节顺序为 R1G1 B1R2 G2B2 ...
+*
+*****************************************************************************************************************************************/
+
+static void LCD_PackRGB444(const uint16_t *src, uint16_t *dst, uint32_t count)
+{
+   uint32_t c0, c1, c2, c3;
+
+   for( ; count >= 4; count -= 4)
+   {
+      // 取 RGB565 每个通道的高4位，组成12位的 RGB444
+      c0 = ((src[0] >> 4) & 0xF00) | ((src[0] >> 3) & 0x0F0) | ((src[0] >> 1) & 0x00F);
+      c1 = ((src[1] >> 4) & 0xF00) | ((src[1] >> 3) & 0x0F0) | ((src[1] >> 1) & 0x00F);
+      c2 = ((src[2] >> 4) & 0xF00) | ((src[2] >> 3) & 0x0F0) | ((src[2] >> 1) & 0x00F);
+      c3 = ((src[3] >> 4) & 0xF00) | ((src[3] >> 3) & 0x0F0) | ((src[3] >> 1) & 0x00F);
+
+      dst[0] = (uint16_t)((c0 << 4) | (c1 >> 8));
+      dst[1] = (uint16_t)((c1 << 8) | (c2 >> 4));
+      dst[2] = (uint16_t)((c2 << 12) | c3);
+
+      src += 4;
+      dst += 3;
+   }
+}
+
+/***************************************************************************************************************************************
+*	函 数 名: LCD_PackRGB666
+*
+*	入口参数: src - RGB565 数据，dst - 打包后的数据，count - 像素个数，按2个像素一组转换
+*
+*	函数功能: 每2个像素打包为3个16位数据，每个通道一个字节，高6位有效，发送时的字节顺序为 R1G1 B1R2 G2B2 ...
+*
+*****************************************************************************************************************************************/
+
+static void LCD_PackRGB666(const uint16_t *src, uint16_t *dst, uint32_t count)
+{
+   uint32_t r0, g0, b0, r1, g1, b1;
+
+   for( ; count >= 2; count -= 2)
+   {
+      // 5位的红色和蓝色通道用高位补齐低位
+      r0 = ((src[0] >> 8) & 0xF8) | (src[0] >> 13);
+      g0 = (src[0] >> 3) & 0xFC;
+      b0 = ((src[0] << 3) & 0xF8) | ((src[0] >> 2) & 0x07);
+      r1 = ((src[1] >> 8) & 0xF8) | (src[1] >> 13);
+      g1 = (src[1] >> 3) & 0xFC;
+      b1 = ((src[1] << 3) & 0xF8) | ((src[1] >> 2) & 0x07);
+
+      dst[0] = (uint16_t)((r0 << 8) | g0);
+      dst[1] = (uint16_t)((b0 << 8) | r1);
+      dst[2] = (uint16_t)((g1 << 8) | b1);
+
+      src += 2;
+      dst += 3;
+   }
+}
+
+/***************************************************************************************************************************************
+*	函 数 名: LCD_WritePacked
+*
+*	入口参数: DataBuff - RGB565 数据，count - 像素个数
+*
+*	函数功能: 把 RGB565 数据分批转换为 RGB444 或 RGB666 格式并写入显存，需要先设置好坐标
+*
+*****************************************************************************************************************************************/
+
+static void LCD_WritePacked(uint16_t *DataBuff, uint32_t count)
+{
+   uint32_t group_pixels;     // 每组的像素数，一组打包为3个16位数据
+   uint32_t batch;            // 本次打包的像素数
+   uint16_t tail[4];          // 最后不满一组的像素
+   uint8_t  tail_bytes[6];
+   uint32_t tail_size;        // 最后不满一组的像素需要发送的字节数
+   uint32_t i;
+
+   group_pixels = (LCD->Pixel_Format == LCD_Format_RGB444) ? 4 : 2;
+
+	LCD_DC_Data;     // 数据指令选择 引脚输出高电平，代表本次传输 数据
+
+// 修改为16位数据宽度，每组的3个16位数据连续发送
+   LCD_SPI.Init.DataSize = SPI_DATASIZE_16BIT;   //	16位数据宽度
+   HAL_SPI_Init(&LCD_SPI);
+
+   while( count >= group_pixels )
+   {
+      batch = sizeof(LCD_PackBuff) / sizeof(LCD_PackBuff[0]) / 3 * group_pixels;
+      if( batch > count )  batch = count - count % group_pixels;
+
+      if( group_pixels == 4 )  LCD_PackRGB444(DataBuff, LCD_PackBuff, batch);
+      else                     LCD_PackRGB666(DataBuff, LCD_PackBuff, batch);
+
+      LCD_SPI_TransmitBuffer(&LCD_SPI, LCD_PackBuff, batch / group_pixels * 3);
+
+      DataBuff += batch;
+      count    -= batch;
+   }
+
+// 改回8位数据宽度，最后不满一组的像素按字节发送，
+// 多出的位不足一个像素，不会写入显存，也就不会回到窗口的开头
+   LCD_SPI.Init.DataSize = SPI_DATASIZE_8BIT;    //	8位数据宽度
+   HAL_SPI_Init(&LCD_SPI);
+
+   if( count > 0 )
+   {
+      memset(tail, 0, sizeof(tail));
+      memcpy(tail, DataBuff, count * sizeof(uint16_t));
+
+      if( group_pixels == 4 )
+      {
+         LCD_PackRGB444(tail, LCD_PackBuff, 4);
+         tail_size = (count * 3 + 1) / 2;    // 每个像素1.5个字节
+      }
+      else
+      {
+         LCD_PackRGB666(tail, LCD_PackBuff, 2);
+         tail_size = count * 3;
+      }
+
+      for(i = 0; i < tail_size; i++)
+      {
+         tail_bytes[i] = (i % 2 == 0) ? (uint8_t)(LCD_PackBuff[i / 2] >> 8) : (uint8_t)LCD_PackBuff[i / 2];
+      }
+      HAL_SPI_Transmit(&LCD_SPI, tail_bytes, tail_size, 1000) ;
+   }
+}
+
+
 void LCD_DisPlayAll(uint16_t* LCD_FrameBuff){
-	LCD_CopyBuffer(0,0,LCD.Width,LCD.Height,LCD_FrameBuff);
+	LCD_CopyBuffer(0,0,LCD->Width,LCD->Height,LCD_FrameBuff);
 }
 
 void LCD_DisPlayPart(uint16_t* LCD_FrameBuff, uint16_t x, uint16_t y, uint16_t width, uint16_t height){
@@ -66,6 +66,9 @@ static void MPU_Config(void);
 
 lv_ui guider_ui;
 
+/* D2 SRAM1/SRAM2 for LVGL's large buffers, next to the LV_MEM_LARGE_SIZE pool in AXI-SRAM */
+static uint64_t lv_mem_d2[32 * 1024 / sizeof(uint64_t)] __attribute__((section(".ram_d2_noinit")));
+
 /* USER CODE END 0 */
 
 /**
@@ -113,6 +116,9 @@ int main(void)
   /* USER CODE BEGIN 2 */
     SPI_LCD_Init();
     lv_init();
+    __HAL_RCC_D2SRAM1_CLK_ENABLE();
+    __HAL_RCC_D2SRAM2_CLK_ENABLE();
+    lv_mem_add_region_pool(LV_MEM_REGION_LARGE, lv_mem_d2, sizeof(lv_mem_d2));
     lv_port_disp_init();
     setup_ui(&guider_ui);
   /* USER CODE END 2 */